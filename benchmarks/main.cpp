@@ -0,0 +1,196 @@
+// Benchmark driver for the strategy/provider pairings in this library.
+//
+// Every scenario is run against a malloc/free baseline so numbers are
+// comparable across machines, and results are emitted as CSV on stdout —
+// one row per (scenario, allocator, thread count) — so runs can be archived
+// and diffed release to release:
+//
+//   scenario,allocator,threads,ops,total_ns,ns_per_op
+//
+// Anything that is not a result row (progress, errors) goes to stderr.
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/provider/unsynchronized_page.hpp>
+#include <allocators/strategy/freelist.hpp>
+#include <allocators/strategy/lock_free_bump.hpp>
+#include <allocators/strategy/segregated_freelist.hpp>
+
+using namespace allocators;
+
+namespace {
+
+constexpr std::size_t kOpsPerThread = 1 << 16;
+constexpr std::array kMixedSizes = {16ul,  24ul,  32ul,  48ul, 64ul,
+                                    96ul,  128ul, 192ul, 256ul};
+
+// Baseline with the same surface as a strategy so scenarios can be written
+// once and run against both.
+struct MallocBaseline {
+  Result<std::byte*> Find(std::size_t size) {
+    auto* p = static_cast<std::byte*>(std::malloc(size));
+    if (!p)
+      return cpp::fail(Error::OutOfMemory);
+    return p;
+  }
+
+  Result<void> Return(std::byte* p) {
+    std::free(p);
+    return {};
+  }
+
+  Result<void> Reset() { return {}; }
+};
+
+void PrintRow(std::string_view scenario, std::string_view allocator,
+              std::size_t threads, std::size_t ops, std::uint64_t total_ns) {
+  std::cout << scenario << "," << allocator << "," << threads << "," << ops
+            << "," << total_ns << "," << (ops ? total_ns / ops : 0) << "\n";
+}
+
+// Run |fn| on |threads| threads, all released at once, and report the wall
+// time across the slowest thread.
+template <class Fn>
+void RunThreads(std::string_view scenario, std::string_view allocator,
+                std::size_t threads, Fn&& fn) {
+  std::atomic<bool> go = false;
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+  for (std::size_t t = 0; t < threads; ++t)
+    workers.emplace_back([&, t]() {
+      while (!go.load())
+        std::this_thread::yield();
+      fn(t);
+    });
+
+  auto begin = std::chrono::steady_clock::now();
+  go.store(true);
+  for (auto& worker : workers)
+    worker.join();
+  auto end = std::chrono::steady_clock::now();
+
+  PrintRow(scenario, allocator, threads, threads * kOpsPerThread,
+           std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+               .count());
+}
+
+// Contended fixed-size allocation: every thread hammers one shared
+// allocator. This is the scenario that exposes CAS retry storms.
+template <class Allocator>
+void BenchmarkContendedFind(std::string_view name, Allocator& allocator,
+                            std::size_t threads) {
+  RunThreads("contended_find_64b", name, threads, [&](std::size_t) {
+    for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+      auto p_or = allocator.Find(64);
+      if (p_or.has_error() && p_or.error() != Error::ReachedMemoryLimit) {
+        std::cerr << "contended_find_64b failed: " << ToString(p_or.error())
+                  << "\n";
+        return;
+      }
+    }
+  });
+}
+
+// Provide/Return page pairs per thread against one shared provider.
+template <class Provider>
+void BenchmarkPageChurn(std::string_view name, std::size_t threads) {
+  Provider provider;
+  RunThreads("page_provide_return", name, threads, [&](std::size_t) {
+    for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+      auto p_or = provider.Provide(1);
+      if (p_or.has_error()) {
+        std::cerr << "page_provide_return failed: " << ToString(p_or.error())
+                  << "\n";
+        return;
+      }
+      (void)provider.Return(p_or.value());
+    }
+  });
+}
+
+void BenchmarkPageChurnMalloc(std::size_t threads) {
+  RunThreads("page_provide_return", "malloc", threads, [&](std::size_t) {
+    for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+      void* p = std::malloc(internal::GetPageSize());
+      std::free(p);
+    }
+  });
+}
+
+// Fragmentation-inducing mixed-size loop: allocate a window of mixed sizes,
+// free every other one, allocate again, then drain. Single-threaded — this
+// measures list management, not contention.
+template <class Allocator>
+void BenchmarkMixedSizes(std::string_view name, Allocator& allocator) {
+  static constexpr std::size_t kWindow = 64;
+
+  RunThreads("mixed_size_churn", name, 1, [&](std::size_t) {
+    std::array<std::byte*, kWindow> live = {};
+    for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+      std::size_t slot = i % kWindow;
+      if (live[slot])
+        (void)allocator.Return(live[slot]);
+
+      auto p_or = allocator.Find(kMixedSizes[i % kMixedSizes.size()]);
+      live[slot] = p_or.has_value() ? p_or.value() : nullptr;
+    }
+
+    for (auto* p : live)
+      if (p)
+        (void)allocator.Return(p);
+  });
+}
+
+} // namespace
+
+int main() {
+  std::cout << "scenario,allocator,threads,ops,total_ns,ns_per_op\n";
+
+  std::size_t max_threads = std::thread::hardware_concurrency();
+  if (max_threads == 0)
+    max_threads = 4;
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    {
+      provider::LockFreePage<> provider;
+      strategy::LockFreeBump<provider::LockFreePage<>> bump(provider);
+      BenchmarkContendedFind("LockFreeBump/LockFreePage", bump, threads);
+      (void)bump.Reset();
+    }
+    {
+      MallocBaseline baseline;
+      BenchmarkContendedFind("malloc", baseline, threads);
+    }
+
+    BenchmarkPageChurn<provider::LockFreePage<>>("LockFreePage", threads);
+    BenchmarkPageChurnMalloc(threads);
+  }
+
+  {
+    provider::LockFreePage<> provider;
+    strategy::FreeList<provider::LockFreePage<>> freelist(provider);
+    BenchmarkMixedSizes("FreeList/LockFreePage", freelist);
+  }
+  {
+    provider::LockFreePage<> provider;
+    strategy::SegregatedFreeList<provider::LockFreePage<>> segregated(
+        provider);
+    BenchmarkMixedSizes("SegregatedFreeList/LockFreePage", segregated);
+    (void)segregated.Reset();
+  }
+  {
+    MallocBaseline baseline;
+    BenchmarkMixedSizes("malloc", baseline);
+  }
+
+  return 0;
+}
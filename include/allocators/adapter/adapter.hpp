@@ -1,45 +1,128 @@
-// Adapter classes for |std::allocator_traits|. Consult each class'
-// documentation for parameters and description of the allocator.
-// The documentation for |std::allocator_traits| can be found at
+// Adapter classes bridging the Strategy types to the standard library's
+// allocator model. |StrategyAdapter| implements the named requirements for
+// |std::allocator_traits| so containers like |std::vector| can sit on any
+// strategy; |StrategyMemoryResource| implements |std::pmr::memory_resource|
+// for the polymorphic containers. The documentation for
+// |std::allocator_traits| can be found at
 // https://en.cppreference.com/w/cpp/memory/allocator_traits.
 
 #pragma once
 
 #include <cstddef>
+#include <memory_resource>
+#include <new>
 
 #include <allocators/common/trait.hpp>
-#include <allocators/provider/lock_free_page.hpp>
-#include <allocators/strategy/lock_free_bump.hpp>
+#include <allocators/internal/util.hpp>
 
 namespace allocators::adapter {
 
-template <class T, class... Args>
-class BumpAdapter
-    : public strategy::LockFreeBump<provider::LockFreePage<>, Args...> {
+// Standard-library allocator over any Strategy. The adapter borrows the
+// strategy rather than owning it — copies of a container (and rebound
+// copies for node-based containers) all share the one strategy, matching
+// how the strategies themselves share a provider. The strategy must
+// outlive every container using it.
+//
+// Allocation failure surfaces as |std::bad_alloc|: the standard allocator
+// contract has no error-code channel, so this is the one place the library
+// throws.
+template <class T, class Strategy>
+requires StrategyTrait<Strategy>
+class StrategyAdapter {
 public:
-  // Require alias for std::allocator_traits to infer other types, e.g.
+  // Required alias for std::allocator_traits to infer other types, e.g.
   // using pointer = value_type*.
   using value_type = T;
 
-  using Parent = strategy::LockFreeBump<Args...>;
+  explicit StrategyAdapter(Strategy& strategy) noexcept
+      : strategy_(&strategy) {}
 
-  T* allocate(std::size_t n) noexcept {
-    Result<std::byte*> ptr_or = Parent::Allocate(n);
+  template <class U>
+  StrategyAdapter(const StrategyAdapter<U, Strategy>& other) noexcept
+      : strategy_(other.strategy_) {}
+
+  T* allocate(std::size_t n) {
+    auto layout = Layout(n * sizeof(T), GetAlignment());
+    Result<std::byte*> ptr_or = strategy_->Find(layout);
     if (ptr_or.has_error())
-      return nullptr;
+      throw std::bad_alloc();
+
     return reinterpret_cast<T*>(ptr_or.value());
   }
 
-  void deallocate(T*, std::size_t) noexcept {}
+  void deallocate(T* p, std::size_t) noexcept {
+    // Strategies without per-object deallocation (e.g. bump allocators)
+    // reject this call; their memory is reclaimed by Reset instead.
+    (void)strategy_->Return(reinterpret_cast<std::byte*>(p));
+  }
+
+private:
+  // Container element alignment still has to satisfy the strategies'
+  // minimum-alignment contract.
+  static constexpr std::size_t GetAlignment() {
+    return std::max(alignof(T), internal::kMinimumAlignment);
+  }
+
+  template <class U, class S>
+  requires StrategyTrait<S>
+  friend class StrategyAdapter;
+
+  template <class U, class V, class S>
+  friend bool operator==(const StrategyAdapter<U, S>&,
+                         const StrategyAdapter<V, S>&);
+
+  Strategy* strategy_;
 };
 
-template <class T, class U>
-bool operator==(const BumpAdapter<T>&, const BumpAdapter<U>&) {
-  return true;
+// Two adapters are interchangeable exactly when they draw from the same
+// strategy instance.
+template <class T, class U, class Strategy>
+bool operator==(const StrategyAdapter<T, Strategy>& lhs,
+                const StrategyAdapter<U, Strategy>& rhs) {
+  return lhs.strategy_ == rhs.strategy_;
 }
 
-template <class T, class U>
-bool operator!=(const BumpAdapter<T>&, const BumpAdapter<U>&) {
-  return false;
+template <class T, class U, class Strategy>
+bool operator!=(const StrategyAdapter<T, Strategy>& lhs,
+                const StrategyAdapter<U, Strategy>& rhs) {
+  return !(lhs == rhs);
 }
+
+// |std::pmr::memory_resource| over any Strategy, letting the polymorphic
+// containers (std::pmr::vector, std::pmr::unordered_map, ...) sit directly
+// on a strategy with no per-container allocator type. The strategy must
+// outlive the resource and every container using it.
+template <class Strategy>
+requires StrategyTrait<Strategy>
+class StrategyMemoryResource final : public std::pmr::memory_resource {
+public:
+  explicit StrategyMemoryResource(Strategy& strategy) noexcept
+      : strategy_(&strategy) {}
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    auto layout =
+        Layout(bytes, std::max(alignment, internal::kMinimumAlignment));
+    Result<std::byte*> ptr_or = strategy_->Find(layout);
+    if (ptr_or.has_error())
+      throw std::bad_alloc();
+
+    return ptr_or.value();
+  }
+
+  void do_deallocate(void* p, std::size_t, std::size_t) override {
+    (void)strategy_->Return(static_cast<std::byte*>(p));
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    // Memory allocated here can only be released through a resource backed
+    // by the very same strategy.
+    auto* resource = dynamic_cast<const StrategyMemoryResource*>(&other);
+    return resource != nullptr && resource->strategy_ == strategy_;
+  }
+
+  Strategy* strategy_;
+};
+
 } // namespace allocators::adapter
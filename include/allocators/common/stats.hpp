@@ -0,0 +1,121 @@
+// Compile-time-gated allocation statistics.
+//
+// Allocators accept a |StatisticsT| named template parameter through the
+// same ntp machinery as their other tunables. When enabled, the owning
+// class embeds a |StatsRecorder| and counts allocations, bytes outstanding,
+// free-list length, CAS retries, and provider round-trips; the counters can
+// be read at any time through GetStatistics(). When disabled (the default),
+// the recorder is an empty type whose calls inline away to nothing, so the
+// hot path is untouched.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace allocators {
+
+// Counters describing allocator behavior at runtime. Counters are updated
+// with relaxed atomics: totals are exact, but a reader racing with writers
+// may observe counters that are mutually slightly out of step.
+struct Statistics {
+  // Number of successful Find/Provide calls.
+  std::atomic<std::uint64_t> allocation_count = 0;
+
+  // Number of successful Return calls.
+  std::atomic<std::uint64_t> release_count = 0;
+
+  // Bytes currently handed out and not yet returned.
+  std::atomic<std::uint64_t> bytes_outstanding = 0;
+
+  // Number of entries currently on the owning allocator's free list. Only
+  // maintained by list-based strategies.
+  std::atomic<std::uint64_t> free_list_length = 0;
+
+  // Number of failed compare-exchange attempts in lock-free loops.
+  std::atomic<std::uint64_t> cas_retries = 0;
+
+  // Number of calls made to the underlying provider.
+  std::atomic<std::uint64_t> provider_round_trips = 0;
+};
+
+// Shared named parameter for opting into statistics. Allocator parameter
+// structs inherit from this the same way they expose their own parameters.
+struct StatsParams {
+  template <bool Enabled>
+  struct StatisticsT : std::integral_constant<bool, Enabled> {};
+};
+
+namespace internal {
+
+// Recorder embedded when statistics are enabled.
+class StatsRecorder {
+public:
+  void RecordFind(std::size_t bytes) {
+    stats_.allocation_count.fetch_add(1, std::memory_order_relaxed);
+    stats_.bytes_outstanding.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  void RecordReturn(std::size_t bytes) {
+    stats_.release_count.fetch_add(1, std::memory_order_relaxed);
+    stats_.bytes_outstanding.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  // Bytes reclaimed without a per-object release, e.g. a bump block
+  // returned to the provider whole once its last object is dead. Keeps
+  // |bytes_outstanding| honest when the count and the bytes are known at
+  // different points.
+  void RecordReclaim(std::size_t bytes) {
+    stats_.bytes_outstanding.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  void RecordFreeListInsert() {
+    stats_.free_list_length.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void RecordFreeListRemove() {
+    stats_.free_list_length.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  void RecordCasRetry() {
+    stats_.cas_retries.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void RecordProviderRoundTrip() {
+    stats_.provider_round_trips.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  const Statistics& GetStatistics() const { return stats_; }
+
+private:
+  Statistics stats_;
+};
+
+// Recorder embedded when statistics are disabled. Every call is an inline
+// no-op and the type is empty, so with [[no_unique_address]] it costs
+// neither time nor space.
+class NullStatsRecorder {
+public:
+  void RecordFind(std::size_t) {}
+  void RecordReturn(std::size_t) {}
+  void RecordReclaim(std::size_t) {}
+  void RecordFreeListInsert() {}
+  void RecordFreeListRemove() {}
+  void RecordCasRetry() {}
+  void RecordProviderRoundTrip() {}
+
+  const Statistics& GetStatistics() const {
+    static Statistics empty;
+    return empty;
+  }
+};
+
+template <bool Enabled>
+using StatsRecorderFor =
+    std::conditional_t<Enabled, StatsRecorder, NullStatsRecorder>;
+
+} // namespace internal
+
+} // namespace allocators
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <allocators/common/error.hpp>
+
+namespace allocators {
+
+// One allocation event in a captured trace. The layout is fixed at 16
+// packed bytes so logs stay compact (a million-event incident is 16MB) and
+// can be written and read back with nothing but fread/fwrite — no
+// serialization library, no endianness translation between the machines we
+// actually run on.
+//
+// |address| records the pointer the strategy handed out (or received). A
+// replay cannot dereference it; it is an identity that lets the replayer
+// pair every Return with the Find that produced it and substitute the live
+// pointer from its own run.
+struct TraceEvent {
+  enum Kind : std::uint8_t {
+    Find = 0,
+    Return = 1,
+    Reset = 2,
+  };
+
+  std::uint8_t kind = Kind::Find;
+  std::uint8_t reserved = 0;
+
+  // Alignment of the request; meaningful for Find only.
+  std::uint16_t alignment = 0;
+
+  // Size of the request in bytes; meaningful for Find only.
+  std::uint32_t size = 0;
+
+  // Pointer identity as described above; zero for Reset.
+  std::uint64_t address = 0;
+};
+
+static_assert(sizeof(TraceEvent) == 16,
+              "TraceEvent must stay 16 bytes; the on-disk format depends on "
+              "it.");
+
+// An append-only in-memory log of TraceEvents with save/load to a flat
+// binary file. Appending is a bounds check and a store into preallocated
+// storage, which keeps the recording overhead on the traced hot path to a
+// few nanoseconds; when the log fills, further events are dropped and
+// counted rather than growing (and reallocating) under the workload being
+// measured.
+class TraceLog {
+public:
+  static constexpr std::size_t kDefaultCapacity = 1 << 20;
+
+  explicit TraceLog(std::size_t capacity = kDefaultCapacity) {
+    events_.reserve(capacity);
+  }
+
+  void Append(TraceEvent event) {
+    if (events_.size() == events_.capacity()) {
+      ++dropped_;
+      return;
+    }
+
+    events_.push_back(event);
+  }
+
+  [[nodiscard]] const std::vector<TraceEvent>& GetEvents() const {
+    return events_;
+  }
+
+  // Events that arrived after the log filled. A nonzero count means the
+  // trace is truncated, not corrupted: everything recorded is valid.
+  [[nodiscard]] std::size_t GetDroppedCount() const { return dropped_; }
+
+  Result<void> Save(const char* path) const {
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr)
+      return cpp::fail(Error::Internal);
+
+    Header header{.count = events_.size()};
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+              (events_.empty() ||
+               std::fwrite(events_.data(), sizeof(TraceEvent), events_.size(),
+                           file) == events_.size());
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok)
+      return cpp::fail(Error::Internal);
+
+    return {};
+  }
+
+  static Result<TraceLog> Load(const char* path) {
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    Header header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        header.magic != Header().magic || header.version != Header().version) {
+      std::fclose(file);
+      return cpp::fail(Error::InvalidInput);
+    }
+
+    TraceLog log(header.count);
+    log.events_.resize(header.count);
+    bool ok = header.count == 0 ||
+              std::fread(log.events_.data(), sizeof(TraceEvent), header.count,
+                         file) == header.count;
+    std::fclose(file);
+    if (!ok)
+      return cpp::fail(Error::InvalidInput);
+
+    return log;
+  }
+
+private:
+  struct Header {
+    std::uint32_t magic = 0x41545243; // "CRTA"
+    std::uint32_t version = 1;
+    std::uint64_t count = 0;
+  };
+
+  std::vector<TraceEvent> events_;
+  std::size_t dropped_ = 0;
+};
+
+} // namespace allocators
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <span>
 
 #include <allocators/common/error.hpp>
 #include <allocators/internal/util.hpp>
@@ -40,9 +41,24 @@ concept AllocatorTrait = requires(T allocator, std::size_t size, Layout layout,
 template <class T>
 concept StrategyTrait = requires(T strategy, const T const_strategy,
                                  std::size_t size, Layout layout,
-                                 std::byte* bytes) {
+                                 std::byte* bytes,
+                                 std::span<std::byte*> batch) {
   { strategy.Find(layout) } -> std::same_as<Result<std::byte*>>;
   { strategy.Find(size) } -> std::same_as<Result<std::byte*>>;
+
+  // Bulk form of |Find|: fills every entry of |batch| with an allocation of
+  // |layout|, or fails without leaking any. Strategies amortize their
+  // synchronization (CAS, lock acquisition) over the whole batch where
+  // possible.
+  { strategy.FindMany(layout, batch) } -> std::same_as<Result<void>>;
+
+  // Resizes the allocation at |bytes| to |size| bytes, growing or shrinking
+  // in place where the strategy's block layout allows it and falling back to
+  // allocate-copy-return otherwise — the returned pointer only differs from
+  // |bytes| in the fallback case. Strategies without the per-allocation
+  // metadata to recover a block's extent report OperationNotSupported.
+  { strategy.Resize(bytes, size) } -> std::same_as<Result<std::byte*>>;
+
   { strategy.Return(bytes) } -> std::same_as<Result<void>>;
   { strategy.Reset() } -> std::same_as<Result<void>>;
 
@@ -52,8 +68,14 @@ concept StrategyTrait = requires(T strategy, const T const_strategy,
 
 template <class T>
 concept ProviderTrait = requires(T provider, const T const_provider,
-                                 std::size_t count, std::byte* bytes) {
+                                 std::size_t count, std::byte* bytes,
+                                 std::span<std::byte*> batch) {
   { provider.Provide(count) } -> std::same_as<Result<std::byte*>>;
+
+  // Bulk form of |Provide|: fills every entry of |batch| with a block of
+  // |count| pages, or fails without leaking any.
+  { provider.ProvideMany(count, batch) } -> std::same_as<Result<void>>;
+
   { provider.Return(bytes) } -> std::same_as<Result<void>>;
   { const_provider.GetBlockSize() } -> std::same_as<std::size_t>;
 };
@@ -36,6 +36,12 @@ struct BlockHeader {
   // standard singly-linked list.
   BlockHeader* next = nullptr;
 
+  // The previous block in the list of blocks. Only maintained by strategies
+  // that keep their free list doubly-linked for O(1) unlinking (see
+  // strategy::FreeList); the find/split helpers below neither read nor
+  // update it.
+  BlockHeader* prev = nullptr;
+
   // Cast |allocation| to |BlockHeader*|.
   static inline BlockHeader* Create(VirtualAddressRange allocation,
                                     BlockHeader* next = nullptr) {
@@ -44,10 +50,32 @@ struct BlockHeader {
     BlockHeader* header = reinterpret_cast<BlockHeader*>(allocation.address);
     header->size = allocation.GetSize();
     header->next = next;
+    header->prev = nullptr;
     return header;
   }
 };
 
+// A BlockFooter is a boundary tag mirrored into the last word of a block.
+// It repeats the block's size together with a free bit, so the block
+// physically following it can locate (and check the status of) its
+// predecessor in constant time — no list walk required. The size is always
+// aligned to at least |kMinimumAlignment|, which frees the low bit for the
+// status flag.
+struct BlockFooter {
+  static constexpr std::uint64_t kFreeBit = 1;
+
+  std::uint64_t data = 0;
+
+  [[nodiscard]] std::size_t GetSize() const { return data & ~kFreeBit; }
+
+  [[nodiscard]] bool IsFree() const { return data & kFreeBit; }
+};
+
+// Fixed size of Block footer.
+inline constexpr std::size_t GetBlockFooterSize() {
+  return sizeof(BlockFooter);
+}
+
 // A pair of BlockHeader* where the |prev| is guaranteed to have its |next|
 // field set to |header|.
 struct HeaderPair {
@@ -89,6 +117,33 @@ inline std::byte* GetBlock(BlockHeader* header) {
   return AsBytePtr(header) + GetBlockHeaderSize();
 }
 
+// Get footer of the block referenced by |header|.
+inline BlockFooter* GetFooter(BlockHeader* header) {
+  assert(header != nullptr);
+  assert(header->size >= GetBlockHeaderSize() + GetBlockFooterSize());
+
+  return reinterpret_cast<BlockFooter*>(AsBytePtr(header) + header->size -
+                                        GetBlockFooterSize());
+}
+
+// Stamp the boundary tag for the block referenced by |header|, recording its
+// current size and whether it is free. Must be re-run whenever the block's
+// size or status changes.
+inline void WriteFooter(BlockHeader* header, bool free) {
+  GetFooter(header)->data =
+      header->size | (free ? BlockFooter::kFreeBit : 0);
+}
+
+// Get the boundary tag of the block physically preceding |header|. The
+// caller is responsible for ensuring a predecessor exists, i.e. |header| is
+// not the first block of its region.
+inline BlockFooter* GetPrecedingFooter(BlockHeader* header) {
+  assert(header != nullptr);
+
+  return reinterpret_cast<BlockFooter*>(AsBytePtr(header) -
+                                        GetBlockFooterSize());
+}
+
 // Get header from block referenced by |ptr|.
 inline BlockHeader* GetHeader(std::byte* ptr) {
   assert(ptr != nullptr);
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <bitset>
+#include <bit>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <optional>
@@ -8,19 +9,83 @@
 #include <allocators/internal/platform.hpp>
 #include <allocators/internal/util.hpp>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace allocators::internal {
 
+// Metadata byte values. A zeroed block must read back as a valid, empty
+// map (see |AsBlockMapPtr|), so "empty" has to be 0. Occupied slots store
+// 0x80 | H2(hash), which can never collide with the two sentinels.
+inline constexpr std::uint8_t kBlockMapEmpty = 0x00;
+inline constexpr std::uint8_t kBlockMapDeleted = 0x01;
+
+// Returns a 16-bit mask with bit i set when |group[i]| == |value|. This is
+// the Swiss-table probe primitive: one comparison covers a whole
+// cache-line-sized bucket of metadata instead of sixteen dependent loads.
+[[gnu::always_inline]] inline std::uint32_t
+MatchMetadataByte(const std::uint8_t* group, std::uint8_t value) {
+#if defined(__SSE2__)
+  __m128i match = _mm_set1_epi8(static_cast<char>(value));
+  __m128i meta =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  return static_cast<std::uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(match, meta)));
+#elif defined(__ARM_NEON)
+  uint8x16_t eq = vceqq_u8(vld1q_u8(group), vdupq_n_u8(value));
+  // Narrow the 16 lane results to a nibble each, giving one bit per lane
+  // at position 4i, then fold those down to a dense 16-bit mask.
+  std::uint64_t nibbles = vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+  std::uint64_t x = nibbles & 0x1111111111111111ull;
+  x |= x >> 3;
+  x |= x >> 6;
+  x |= x >> 12;
+  x |= x >> 24;
+  return static_cast<std::uint32_t>(x & 0xFFFF);
+#else
+  // Portable SWAR fallback: zero-byte detection over two 8-byte halves.
+  std::uint32_t mask = 0;
+  for (std::size_t half = 0; half < 2; ++half) {
+    std::uint64_t word;
+    std::memcpy(&word, group + half * 8, sizeof(word));
+    word ^= 0x0101010101010101ull * value;
+    std::uint64_t zero =
+        (word - 0x0101010101010101ull) & ~word & 0x8080808080808080ull;
+    // |zero| has one bit per matching byte at position 8i + 7; fold those
+    // down to a dense 8-bit mask.
+    zero >>= 7;
+    zero |= zero >> 7;
+    zero |= zero >> 14;
+    zero |= zero >> 28;
+    mask |= static_cast<std::uint32_t>(zero & 0xFF) << (half * 8);
+  }
+  return mask;
+#endif
+}
+
+// Open-addressing map from page address to the VirtualAddressRange that was
+// handed out at it, stored Swiss-table style: slots are grouped into
+// 16-wide buckets, and each bucket carries a 16-byte metadata array holding
+// a 7-bit hash fragment per occupied slot. A probe compares the whole
+// bucket's metadata in one SIMD compare-mask, so a lookup touches a couple
+// of cache lines instead of a chain of dependent scalar probes. A
+// min/max resident-range filter rejects addresses this map cannot contain
+// without probing at all, which keeps walking a chain of maps cheap.
 template <std::size_t Size> class BlockMap {
 public:
   ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(BlockMap);
 
   bool IsFull() const { return GetSize() == GetCapacity(); }
 
-  bool IsEmpty() const { return header.occupied.none(); }
+  bool IsEmpty() const { return header.size == 0; }
 
   bool HasNext() const { return header.next != nullptr; }
 
-  std::size_t GetSize() const { return header.occupied.count(); }
+  std::size_t GetSize() const { return header.size; }
 
   std::size_t GetCapacity() const { return kCapacity; }
 
@@ -29,82 +94,123 @@ public:
   }
 
   bool Insert(VirtualAddressRange va_range) {
+    if (IsFull())
+      return false;
+
     auto key = va_range.address;
-    std::hash<std::uint64_t> hasher;
-    std::size_t hash = hasher(key);
-    std::size_t startIndex = hash % GetCapacity();
-    std::size_t probeIndex = startIndex;
-
-    if (header.occupied[probeIndex]) {
-      do {
-        probeIndex = (probeIndex + 1) % GetCapacity();
-      } while (probeIndex != startIndex && header.occupied[probeIndex]);
-
-      if (probeIndex == startIndex)
-        return false;
+    std::size_t hash = std::hash<std::uint64_t>{}(key);
+    std::uint8_t h2 = H2(hash);
+
+    std::size_t group = H1(hash) % kGroupCount;
+    for (std::size_t probe = 0; probe < kGroupCount; ++probe) {
+      const std::uint8_t* meta = &metadata[group * kGroupSize];
+      std::uint32_t free = MatchMetadataByte(meta, kBlockMapEmpty) |
+                           MatchMetadataByte(meta, kBlockMapDeleted);
+      if (free != 0) {
+        std::size_t slot =
+            group * kGroupSize + std::countr_zero(free);
+        table[slot] = va_range;
+        metadata[slot] = h2;
+
+        if (header.size == 0) {
+          header.filter_low = key;
+          header.filter_high = key;
+        } else {
+          header.filter_low = std::min<std::uint64_t>(header.filter_low, key);
+          header.filter_high =
+              std::max<std::uint64_t>(header.filter_high, key);
+        }
+
+        ++header.size;
+        return true;
+      }
+
+      group = (group + 1) % kGroupCount;
     }
 
-    table[probeIndex] = va_range;
-    header.occupied.set(probeIndex);
-    return true;
+    return false;
   }
 
   std::optional<VirtualAddressRange> Take(std::uint64_t key) {
-    auto index_or = Locate(key);
-    if (!index_or.has_value())
+    // The resident-range filter turns most misses into two comparisons.
+    // Removals never shrink the range, which only costs false positives.
+    if (header.size == 0 || key < header.filter_low ||
+        key > header.filter_high)
       return std::nullopt;
 
-    auto index = index_or.value();
-    auto value = table[index];
-    header.occupied.reset(index);
-    return value;
-  }
-
-  void SetNext(std::byte* next) { header.next = next; }
-
-private:
-  std::optional<std::size_t> Locate(std::uint64_t address) const {
-    std::hash<std::uint64_t> hasher;
-    std::size_t hash = hasher(address);
-    std::size_t startIndex = hash % GetCapacity();
-    std::size_t probeIndex = startIndex;
-
-    do {
-      if (header.occupied[probeIndex]) {
-        if (table[probeIndex].address == address)
-          return probeIndex;
-
-        // The stopping condition for this probe is not when it
-        // encounters the first empty slot. Rather, it's when ti
-        // encounters a table entry with a different address. The
-        // reason for this is that for the pathological case where
-        // all entries have same entries, we can get false negatives
-        // after removing the first entry. This will happen because the
-        // probe algorithm will see an empty slot and return std::nullopt,
-        // even though all subsequent slots are taken with equivalent
-        // entries.
-        if (table[probeIndex].address != address)
-          return std::nullopt;
+    std::size_t hash = std::hash<std::uint64_t>{}(key);
+    std::uint8_t h2 = H2(hash);
+
+    std::size_t group = H1(hash) % kGroupCount;
+    for (std::size_t probe = 0; probe < kGroupCount; ++probe) {
+      const std::uint8_t* meta = &metadata[group * kGroupSize];
+
+      for (std::uint32_t match = MatchMetadataByte(meta, h2); match != 0;
+           match &= match - 1) {
+        std::size_t slot =
+            group * kGroupSize + std::countr_zero(match);
+        if (table[slot].address != key)
+          continue;
+
+        auto value = table[slot];
+        // Tombstone rather than empty: a later duplicate of this key may
+        // live further along the probe chain, and an empty slot would end
+        // the search for it early.
+        metadata[slot] = kBlockMapDeleted;
+        --header.size;
+        return value;
       }
 
-      probeIndex = (probeIndex + 1) % GetCapacity();
-    } while (probeIndex != startIndex);
+      // An empty slot ends the probe chain; the key was never inserted
+      // past this group.
+      if (MatchMetadataByte(meta, kBlockMapEmpty) != 0)
+        return std::nullopt;
+
+      group = (group + 1) % kGroupCount;
+    }
 
     return std::nullopt;
   }
 
-  static constexpr std::size_t kEntrySize = sizeof(VirtualAddressRange);
-  static constexpr std::size_t kMaxEntriesEstimate =
-      Size / sizeof(VirtualAddressRange);
+  void SetNext(std::byte* next) { header.next = next; }
+
+  // Invokes |fn| on every resident entry, in table order. Bulk paths
+  // (e.g. whole-arena teardown) drain the map this way instead of paying
+  // a per-key probe.
+  template <class Fn> void ForEach(Fn&& fn) const {
+    for (std::size_t slot = 0; slot < kCapacity; ++slot)
+      if (metadata[slot] & 0x80)
+        fn(table[slot]);
+  }
+
+private:
+  static constexpr std::size_t kGroupSize = 16;
 
   struct Header {
     std::byte* next;
-    std::bitset<kMaxEntriesEstimate> occupied;
+    std::size_t size;
+
+    // Bounds of every address ever inserted. Zeroed state is harmless
+    // because |size| == 0 short-circuits first.
+    std::uint64_t filter_low;
+    std::uint64_t filter_high;
   };
 
-  static constexpr std::size_t kCapacity = (Size - sizeof(Header)) / kEntrySize;
+  // Each group costs 16 metadata bytes plus 16 table entries.
+  static constexpr std::size_t kGroupCount =
+      (Size - sizeof(Header)) /
+      (kGroupSize * (1 + sizeof(VirtualAddressRange)));
+
+  static constexpr std::size_t kCapacity = kGroupCount * kGroupSize;
+
+  static constexpr std::size_t H1(std::size_t hash) { return hash >> 7; }
+
+  static constexpr std::uint8_t H2(std::size_t hash) {
+    return 0x80 | (hash & 0x7F);
+  }
 
   Header header;
+  std::uint8_t metadata[kCapacity];
   VirtualAddressRange table[kCapacity];
 };
 
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <allocators/internal/util.hpp>
+
+namespace allocators::internal {
+
+// Fixed-size occupancy bitmap over a memory block: one bit per
+// |kMinimumAlignment| granule, set while an allocation starts at that
+// granule. Strategies embed one per provider block to validate incoming
+// pointers — a double free or a pointer that never began an allocation is
+// caught by a single bit test instead of a list walk, cheap enough to
+// leave enabled outside of debug builds.
+//
+// The map carries no constructor on purpose: it is placed into raw
+// provider memory, so callers must |Reset| it before first use.
+template <std::size_t BlockSize> class OccupancyMap {
+public:
+  static constexpr std::size_t kGranule = kMinimumAlignment;
+  static constexpr std::size_t kBitCount = BlockSize / kGranule;
+
+  static_assert(BlockSize % kGranule == 0,
+                "BlockSize must be a multiple of the granule.");
+
+  // Clears every bit. Provider memory is not guaranteed zeroed.
+  void Reset() { std::memset(bits_, 0, sizeof(bits_)); }
+
+  // Marks the granule at byte |offset| live. Returns false when it was
+  // already marked or |offset| lies outside the block.
+  bool Mark(std::size_t offset) {
+    if (offset >= BlockSize)
+      return false;
+
+    std::uint64_t& word = bits_[GetIndex(offset) / kBitsPerWord];
+    std::uint64_t bit = 1ull << (GetIndex(offset) % kBitsPerWord);
+    if (word & bit)
+      return false;
+
+    word |= bit;
+    return true;
+  }
+
+  // Clears the granule at byte |offset|. Returns false when it was not
+  // marked — a double free or a pointer that never began an allocation —
+  // or |offset| lies outside the block.
+  bool Clear(std::size_t offset) {
+    if (offset >= BlockSize)
+      return false;
+
+    std::uint64_t& word = bits_[GetIndex(offset) / kBitsPerWord];
+    std::uint64_t bit = 1ull << (GetIndex(offset) % kBitsPerWord);
+    if (!(word & bit))
+      return false;
+
+    word &= ~bit;
+    return true;
+  }
+
+  [[nodiscard]] bool IsMarked(std::size_t offset) const {
+    if (offset >= BlockSize)
+      return false;
+
+    return bits_[GetIndex(offset) / kBitsPerWord] &
+           (1ull << (GetIndex(offset) % kBitsPerWord));
+  }
+
+private:
+  static constexpr std::size_t kBitsPerWord = 64;
+  static constexpr std::size_t kWordCount =
+      (kBitCount + kBitsPerWord - 1) / kBitsPerWord;
+
+  [[nodiscard]] static constexpr std::size_t GetIndex(std::size_t offset) {
+    return offset / kGranule;
+  }
+
+  std::uint64_t bits_[kWordCount];
+};
+
+} // namespace allocators::internal
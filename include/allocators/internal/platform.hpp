@@ -31,8 +31,53 @@ struct VirtualAddressRange {
 
 Failable<VirtualAddressRange> FetchPages(std::size_t count);
 
+// Fetch |count| pages whose base address is a multiple of |alignment|
+// (in bytes; a power of two no smaller than the page size). Natural
+// alignment lets a consumer recover the range base from any interior
+// pointer with a single AND-mask instead of a range check. Implemented by
+// mapping |alignment| extra bytes and trimming the misaligned head and
+// unused tail.
+Failable<VirtualAddressRange> FetchAlignedPages(std::size_t count,
+                                                std::size_t alignment);
+
+Failable<VirtualAddressRange> FetchHugePages(std::size_t count);
+
+// Reserve a range of address space without committing it. The range is
+// unreadable and unwritable (and costs no physical memory or commit charge)
+// until regions of it are committed with |CommitPages|.
+Failable<VirtualAddressRange> ReservePages(std::size_t count);
+
+// As |ReservePages|, but the reserved range starts on an |alignment|-byte
+// boundary (see |FetchAlignedPages| for the constraints and rationale).
+Failable<VirtualAddressRange> ReserveAlignedPages(std::size_t count,
+                                                  std::size_t alignment);
+
+// Commit a region previously reserved with |ReservePages|, making it
+// readable and writable. Committing an already-committed region is harmless.
+Failable<void> CommitPages(VirtualAddressRange region);
+
+// Tell the kernel that the physical memory backing |region| may be
+// reclaimed while keeping the mapping itself intact. The range stays
+// readable and writable; its contents are undefined afterwards, and
+// touching the pages again provides fresh zeroed memory without a new
+// mapping. Platforms without madvise treat this as a successful no-op.
+Failable<void> DiscardPages(VirtualAddressRange region);
+
 Failable<void> ReturnPages(VirtualAddressRange allocation);
 
+// The NUMA node the calling thread is currently executing on. Platforms
+// (or kernels) without NUMA support always report node 0.
+std::size_t GetCurrentNumaNode();
+
+// Ask the kernel to place the physical memory backing |region| on |node|.
+// The policy applies to pages not yet faulted in — already-resident pages
+// stay where they are — so this composes with lazily-committed
+// reservations. The preferred policy is used rather than a strict bind: a
+// node that runs out of memory falls over to the others instead of failing
+// the fault. Platforms without NUMA support treat this as a successful
+// no-op, leaving placement to first-touch.
+Failable<void> BindToNumaNode(VirtualAddressRange region, std::size_t node);
+
 } // namespace allocators::internal
 
 namespace allocators::internal {
@@ -46,6 +91,10 @@ constexpr inline std::size_t GetPageSize() { return 1 << 14; }
 constexpr inline std::size_t GetPageSize() { return 1 << 12; }
 #endif
 
+// Gets the huge page size (in bytes) for the current platform. 2MB is the
+// default huge page size on every supported platform.
+constexpr inline std::size_t GetHugePageSize() { return 1 << 21; }
+
 } // namespace allocators::internal
 
 // TODO: Add Windows support
@@ -54,6 +103,11 @@ constexpr inline std::size_t GetPageSize() { return 1 << 12; }
 #include <sys/mman.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <cerrno>
+#include <sys/syscall.h>
+#endif
+
 namespace allocators::internal {
 
 inline Failable<VirtualAddressRange> FetchPages(std::size_t count) {
@@ -73,6 +127,129 @@ inline Failable<VirtualAddressRange> FetchPages(std::size_t count) {
                              .count = count};
 }
 
+// Shared trim-to-alignment implementation behind |FetchAlignedPages| and
+// |ReserveAlignedPages|. Maps |alignment| extra bytes, then unmaps the
+// misaligned head and whatever tail the aligned range doesn't cover.
+inline Failable<VirtualAddressRange>
+MapAlignedPages(std::size_t count, std::size_t alignment, int prot,
+                int flags) {
+  if (count == 0)
+    return cpp::fail(Failure::InvalidSize);
+
+  if (!IsPowerOfTwo(alignment) || alignment < GetPageSize())
+    return cpp::fail(Failure::InvalidAlignment);
+
+  std::size_t size = count * GetPageSize();
+  std::size_t total = size + alignment;
+
+  void* ptr = mmap(NULL, total, prot, flags, -1, 0);
+
+  // TODO: Log platform error
+  if (ptr == MAP_FAILED)
+    return cpp::fail(Failure::AllocationFailed);
+
+  auto raw = reinterpret_cast<std::uintptr_t>(ptr);
+  std::uintptr_t base = (raw + alignment - 1) & ~(alignment - 1);
+
+  if (std::size_t head = base - raw; head != 0)
+    (void)munmap(ptr, head);
+
+  if (std::size_t tail = total - (base - raw) - size; tail != 0)
+    (void)munmap(reinterpret_cast<void*>(base + size), tail);
+
+  return VirtualAddressRange{.address = base, .count = count};
+}
+
+inline Failable<VirtualAddressRange> FetchAlignedPages(std::size_t count,
+                                                       std::size_t alignment) {
+  return MapAlignedPages(count, alignment, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS);
+}
+
+inline Failable<VirtualAddressRange>
+ReserveAlignedPages(std::size_t count, std::size_t alignment) {
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_NORESERVE)
+  flags |= MAP_NORESERVE;
+#endif
+
+  return MapAlignedPages(count, alignment, PROT_NONE, flags);
+}
+
+inline Failable<VirtualAddressRange> FetchHugePages(std::size_t count) {
+  if (count == 0)
+    return cpp::fail(Failure::InvalidSize);
+
+  std::size_t size = count * GetHugePageSize();
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+  void* ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+  if (ptr != MAP_FAILED)
+    return VirtualAddressRange{.address = reinterpret_cast<std::uint64_t>(ptr),
+                               .count = size / GetPageSize()};
+#endif
+
+  // Fall back to regular pages when the platform lacks huge page support or
+  // the kernel's huge page pool is exhausted. Callers keep working, they
+  // just lose the TLB benefit. The fallback preserves the natural huge-page
+  // alignment of the real thing so consumers can rely on it either way.
+  return FetchAlignedPages(size / GetPageSize(), GetHugePageSize());
+}
+
+inline Failable<VirtualAddressRange> ReservePages(std::size_t count) {
+  if (count == 0)
+    return cpp::fail(Failure::InvalidSize);
+
+  std::size_t size = count * GetPageSize();
+
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_NORESERVE)
+  flags |= MAP_NORESERVE;
+#endif
+
+  void* ptr = mmap(NULL, size, PROT_NONE, flags, -1, 0);
+
+  // TODO: Log platform error
+  if (ptr == MAP_FAILED)
+    return cpp::fail(Failure::AllocationFailed);
+
+  return VirtualAddressRange{.address = reinterpret_cast<std::uint64_t>(ptr),
+                             .count = count};
+}
+
+inline Failable<void> CommitPages(VirtualAddressRange region) {
+  void* address = reinterpret_cast<void*>(region.address);
+  // TODO: Log platform error
+  if (auto result = mprotect(address, region.GetSize(), PROT_READ | PROT_WRITE);
+      result != 0)
+    return cpp::fail(Failure::AllocationFailed);
+
+  return {};
+}
+
+inline Failable<void> DiscardPages(VirtualAddressRange region) {
+  void* address = reinterpret_cast<void*>(region.address);
+
+  // MADV_FREE is preferred: the kernel reclaims lazily and re-touching the
+  // range before reclaim costs nothing. MADV_DONTNEED reclaims eagerly but
+  // is available everywhere madvise is.
+#if defined(MADV_FREE)
+  if (madvise(address, region.GetSize(), MADV_FREE) == 0)
+    return {};
+#endif
+#if defined(MADV_DONTNEED)
+  if (madvise(address, region.GetSize(), MADV_DONTNEED) == 0)
+    return {};
+
+  // TODO: Log platform error
+  return cpp::fail(Failure::ReleaseFailed);
+#else
+  return {};
+#endif
+}
+
 inline Failable<void> ReturnPages(VirtualAddressRange allocation) {
   void* address = reinterpret_cast<void*>(allocation.address);
   // TODO: Log platform error
@@ -82,6 +259,51 @@ inline Failable<void> ReturnPages(VirtualAddressRange allocation) {
   return {};
 }
 
+inline std::size_t GetCurrentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+  // Raw syscall instead of libnuma so the library stays dependency-free.
+  // vDSO makes this cheap enough for an allocation path.
+  unsigned int node = 0;
+  if (syscall(SYS_getcpu, nullptr, &node, nullptr) != 0)
+    return 0;
+
+  return node;
+#else
+  return 0;
+#endif
+}
+
+inline Failable<void> BindToNumaNode(VirtualAddressRange region,
+                                     std::size_t node) {
+#if defined(__linux__) && defined(SYS_mbind)
+  // MPOL_PREFERRED from <numaif.h>, spelled out so headers from libnuma-dev
+  // are not required to build.
+  constexpr int kModePreferred = 1;
+  constexpr std::size_t kMaxNode = 8 * sizeof(unsigned long);
+
+  if (node >= kMaxNode)
+    return cpp::fail(Failure::InvalidSize);
+
+  unsigned long nodemask = 1ul << node;
+  void* address = reinterpret_cast<void*>(region.address);
+  if (syscall(SYS_mbind, address, region.GetSize(), kModePreferred, &nodemask,
+              kMaxNode + 1, 0) == 0)
+    return {};
+
+  // Kernels built without NUMA support reject the syscall outright; locality
+  // then falls back to first-touch, which is not an error.
+  if (errno == ENOSYS)
+    return {};
+
+  // TODO: Log platform error
+  return cpp::fail(Failure::AllocationFailed);
+#else
+  (void)region;
+  (void)node;
+  return {};
+#endif
+}
+
 } // namespace allocators::internal
 
 #endif
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include <template/parameters.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/internal/block_map.hpp>
+#include <allocators/internal/util.hpp>
+
+namespace allocators::provider {
+
+// Parameters for CachingPage class defined below.
+struct CachingPageParams {
+  static constexpr std::size_t kDefaultCacheLimit = 1024;
+
+  // Max number of pages held in the recycling cache. Returns past this
+  // limit unmap immediately. Larger caches absorb bigger sawtooth swings
+  // at the cost of more reserved address space held onto.
+  template <std::size_t N>
+  struct CacheLimitT : std::integral_constant<std::size_t, N> {};
+};
+
+// Provider class that recycles returned blocks instead of unmapping them.
+// Sawtooth workloads — build a heap up, tear it all down, repeat — pay a
+// fresh mmap plus a page-fault storm on every phase boundary when blocks
+// round-trip through the kernel. Here a returned block stays mapped: its
+// backing memory is released with |internal::DiscardPages| (MADV_FREE,
+// falling back to MADV_DONTNEED), and the range is parked on an intrusive
+// free list threaded through the blocks themselves. A subsequent Provide
+// of the same page count pops a parked range with no syscall at all; the
+// kernel repopulates the pages with zeroed memory on first touch.
+//
+// The cache node lives in the leading page of each parked block, which is
+// deliberately excluded from the discard so the kernel cannot reclaim the
+// list out from under us. This provider is not thread-safe.
+template <class... Args> class CachingPage : public CachingPageParams {
+public:
+  static constexpr std::size_t kCacheLimit = std::max(
+      {kDefaultCacheLimit, ntp::optional<CacheLimitT<0>, Args...>::value});
+
+  CachingPage() = default;
+
+  ~CachingPage() {
+    CacheNode* node = cache_;
+    while (node != nullptr) {
+      CacheNode* next = node->next;
+      (void)internal::ReturnPages(internal::VirtualAddressRange{
+          .address = reinterpret_cast<std::uint64_t>(node),
+          .count = node->count});
+      node = next;
+    }
+  }
+
+  ALLOCATORS_NO_COPY_NO_MOVE(CachingPage);
+
+  Result<std::byte*> Provide(std::size_t count) {
+    if (count == 0 || count > internal::VirtualAddressRange::kMaxPageCount)
+        [[unlikely]]
+      return cpp::fail(Error::InvalidInput);
+
+    if (OutOfSpace()) {
+      if (auto result = FetchNewBlockMap(); result.has_error())
+        return cpp::fail(result.error());
+    }
+
+    if (auto va_range_or = TakeCached(count); va_range_or.has_value()) {
+      head_->Insert(va_range_or.value());
+      return internal::ToBytePtr(va_range_or.value().address);
+    }
+
+    auto va_range_or = internal::FetchPages(count);
+    if (va_range_or.has_error()) [[unlikely]]
+      return cpp::fail(Error::Internal);
+
+    auto va_range = va_range_or.value();
+    head_->Insert(va_range);
+
+    return internal::ToBytePtr(va_range.address);
+  }
+
+  // Bulk form of |Provide|. There is no synchronization here to amortize,
+  // so this is a convenience loop; on failure every block already handed
+  // out is returned before the error surfaces.
+  Result<void> ProvideMany(std::size_t count, std::span<std::byte*> out) {
+    if (out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      auto block_or = Provide(count);
+      if (block_or.has_error()) {
+        while (i > 0)
+          (void)Return(out[--i]);
+
+        return cpp::fail(block_or.error());
+      }
+
+      out[i] = block_or.value();
+    }
+
+    return {};
+  }
+
+  Result<void> Return(std::byte* bytes) {
+    if (bytes == nullptr) [[unlikely]]
+      return cpp::fail(Error::InvalidInput);
+
+    auto address = internal::FromBytePtr<std::uint64_t>(bytes);
+
+    BlockMap* itr = head_;
+    while (itr != nullptr) {
+      if (auto value_or = itr->Take(address); value_or.has_value()) {
+        InsertCached(value_or.value());
+        return {};
+      }
+
+      itr = itr->GetNext();
+    }
+
+    return cpp::fail(Error::InvalidInput);
+  }
+
+  static constexpr std::size_t GetBlockSize() {
+    return internal::GetPageSize();
+  }
+
+private:
+  using BlockMap = internal::BlockMap<GetBlockSize()>;
+
+  // Free-list node written into the leading page of a parked block. The
+  // rest of the block is discarded; this page stays resident so the link
+  // and the page count survive until the block is reused or unmapped.
+  struct CacheNode {
+    CacheNode* next;
+    std::size_t count;
+  };
+
+  // First-fit over the parked ranges, matching the page count exactly so a
+  // recycled block is indistinguishable from a fresh one.
+  std::optional<internal::VirtualAddressRange> TakeCached(std::size_t count) {
+    for (CacheNode** link = &cache_; *link != nullptr;
+         link = &(*link)->next) {
+      if ((*link)->count != count)
+        continue;
+
+      CacheNode* node = *link;
+      *link = node->next;
+      cached_pages_ -= count;
+      return internal::VirtualAddressRange{
+          .address = reinterpret_cast<std::uint64_t>(node), .count = count};
+    }
+
+    return std::nullopt;
+  }
+
+  void InsertCached(internal::VirtualAddressRange va_range) {
+    if (cached_pages_ + va_range.count > kCacheLimit) {
+      (void)internal::ReturnPages(va_range); // TODO: Don't ignore error
+      return;
+    }
+
+    // Release everything past the leading page back to the kernel. The
+    // leading page holds the cache node and must stay resident.
+    if (va_range.count > 1)
+      (void)internal::DiscardPages(internal::VirtualAddressRange{
+          .address = va_range.address + internal::GetPageSize(),
+          .count = static_cast<std::uint64_t>(va_range.count) - 1});
+
+    auto* node = reinterpret_cast<CacheNode*>(va_range.address);
+    node->next = cache_;
+    node->count = va_range.count;
+    cache_ = node;
+    cached_pages_ += va_range.count;
+  }
+
+  bool OutOfSpace() const { return head_ == nullptr || head_->IsFull(); }
+
+  Result<void> FetchNewBlockMap() {
+    auto va_range_or = internal::FetchPages(1);
+    if (va_range_or.has_error())
+      return cpp::fail(Error::Internal);
+
+    auto va_range = va_range_or.value();
+
+    BlockMap* new_block_map = internal::AsBlockMapPtr<GetBlockSize()>(
+        internal::ToBytePtr(va_range.address));
+
+    new_block_map->SetNext(reinterpret_cast<std::byte*>(head_));
+    head_ = new_block_map;
+
+    return {};
+  }
+
+  BlockMap* head_ = nullptr;
+
+  CacheNode* cache_ = nullptr;
+  std::size_t cached_pages_ = 0;
+};
+
+} // namespace allocators::provider
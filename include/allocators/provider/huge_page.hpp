@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include <allocators/common/error.hpp>
+#include <allocators/internal/block_map.hpp>
+#include <allocators/internal/util.hpp>
+
+namespace allocators::provider {
+
+// Provider class that returns huge-page-sized blocks, 2MB on every supported
+// platform. Backing memory is requested with |internal::FetchHugePages|,
+// which uses the kernel's huge page support when available and transparently
+// falls back to regular pages otherwise — strategies parameterized on this
+// provider need no changes either way. Use this over |UnsynchronizedPage|
+// for large resident heaps where TLB pressure matters. This provider is not
+// thread-safe.
+template <class... Args> class HugePage {
+public:
+  HugePage() = default;
+  ~HugePage() = default;
+
+  ALLOCATORS_NO_COPY_NO_MOVE(HugePage);
+
+  Result<std::byte*> Provide(std::size_t count) {
+    if (count == 0 ||
+        count > internal::VirtualAddressRange::kMaxPageCount /
+                    (GetBlockSize() / internal::GetPageSize())) [[unlikely]]
+      return cpp::fail(Error::InvalidInput);
+
+    if (OutOfSpace()) {
+      if (auto result = FetchNewBlockMap(); result.has_error())
+        return cpp::fail(result.error());
+    }
+
+    auto va_range_or = internal::FetchHugePages(count);
+    if (va_range_or.has_error()) [[unlikely]]
+      return cpp::fail(Error::Internal);
+
+    auto va_range = va_range_or.value();
+    head_->Insert(va_range);
+
+    return internal::ToBytePtr(va_range.address);
+  }
+
+  // Bulk form of |Provide|. There is no synchronization here to amortize,
+  // so this is a convenience loop; on failure every block already handed
+  // out is returned before the error surfaces.
+  Result<void> ProvideMany(std::size_t count, std::span<std::byte*> out) {
+    if (out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      auto block_or = Provide(count);
+      if (block_or.has_error()) {
+        while (i > 0)
+          (void)Return(out[--i]);
+
+        return cpp::fail(block_or.error());
+      }
+
+      out[i] = block_or.value();
+    }
+
+    return {};
+  }
+
+  Result<void> Return(std::byte* bytes) {
+    if (bytes == nullptr) [[unlikely]]
+      return cpp::fail(Error::InvalidInput);
+
+    auto address = internal::FromBytePtr<std::uint64_t>(bytes);
+
+    BlockMap* itr = head_;
+    while (itr != nullptr) {
+      if (auto value_or = itr->Take(address); value_or.has_value()) {
+        (void)internal::ReturnPages(
+            value_or.value()); // TODO: Don't ignore error
+
+        return {};
+      }
+
+      itr = itr->GetNext();
+    }
+
+    return cpp::fail(Error::InvalidInput);
+  }
+
+  static constexpr std::size_t GetBlockSize() {
+    return internal::GetHugePageSize();
+  }
+
+private:
+  // The map itself lives on a regular page; only the blocks handed out are
+  // huge-page sized.
+  using BlockMap = internal::BlockMap<internal::GetPageSize()>;
+
+  bool OutOfSpace() const { return head_ == nullptr || head_->IsFull(); }
+
+  Result<void> FetchNewBlockMap() {
+    auto va_range_or = internal::FetchPages(1);
+    if (va_range_or.has_error())
+      return cpp::fail(Error::Internal);
+
+    auto va_range = va_range_or.value();
+
+    BlockMap* new_block_map = internal::AsBlockMapPtr<internal::GetPageSize()>(
+        internal::ToBytePtr(va_range.address));
+
+    new_block_map->SetNext(reinterpret_cast<std::byte*>(head_));
+    head_ = new_block_map;
+
+    return {};
+  }
+
+  BlockMap* head_ = nullptr;
+};
+
+} // namespace allocators::provider
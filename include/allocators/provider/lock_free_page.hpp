@@ -1,13 +1,18 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <thread>
 
 #include <template/parameters.hpp>
 
 #include <allocators/common/error.hpp>
+#include <allocators/common/stats.hpp>
 #include <allocators/common/trait.hpp>
 #include <allocators/internal/platform.hpp>
 #include <allocators/internal/util.hpp>
@@ -15,7 +20,7 @@
 namespace allocators::provider {
 
 // Parameters for LockFreePage class defined below.
-struct LockFreePageParams {
+struct LockFreePageParams : StatsParams {
   static constexpr std::uint64_t kDefaultLimit = (1 << 18) - 1;
 
   // Max number of pages that Provider will create. This is a strict limit.
@@ -32,6 +37,9 @@ struct LockFreePageParams {
 // is thread-safe using lock-free algorithms.
 template <class... Args> class LockFreePage : public LockFreePageParams {
 public:
+  static constexpr bool kStatisticsEnabled =
+      ntp::optional<StatisticsT<false>, Args...>::value;
+
   LockFreePage() = default;
 
   ALLOCATORS_NO_COPY_NO_MOVE(LockFreePage);
@@ -40,10 +48,10 @@ public:
     if (count == 0 || count > kLimit)
       return cpp::fail(Error::InvalidInput);
 
-    // TODO: Currently, this allocator doesn't support requesting more than
-    //  one page at a time.
+    // Contiguous runs can't be served off the LIFO head; they go through a
+    // first-fit scan of the descriptor list instead.
     if (count != 1)
-      return cpp::fail(Error::OperationNotSupported);
+      return ProvideRun(count);
 
     while (true) {
       auto old_anchor = anchor_.load();
@@ -57,47 +65,252 @@ public:
         continue;
       }
 
-      if (old_anchor.available == 0 || old_anchor.head == kLimit)
+      // Prefer recycling off the LIFO; its pages and descriptors are
+      // already committed. Otherwise claim a fresh page at the watermark,
+      // committing it (and its descriptor) on first use.
+      if (old_anchor.available > 0 && old_anchor.head != kLimit) {
+        auto new_anchor = old_anchor;
+        new_anchor.available = old_anchor.available - 1;
+        new_anchor.head = GetHeap()->descriptors[old_anchor.head].next;
+        if (anchor_.compare_exchange_weak(old_anchor, new_anchor)) {
+          auto& descriptor = GetHeap()->descriptors[old_anchor.head];
+          descriptor.occupied = true;
+          descriptor.count = 1;
+          descriptor.next = 0;
+          auto ptr =
+              reinterpret_cast<std::byte*>(GetHeap()->super_block.address) +
+              old_anchor.head * internal::GetPageSize();
+          recorder_.RecordFind(internal::GetPageSize());
+          return reinterpret_cast<std::byte*>(ptr);
+        }
+
+        recorder_.RecordCasRetry();
+        continue;
+      }
+
+      if (old_anchor.watermark == kLimit)
         return cpp::fail(Error::NoFreeBlock);
 
       auto new_anchor = old_anchor;
-      new_anchor.available = old_anchor.available - 1;
-      new_anchor.head = GetHeap()->descriptors[old_anchor.head].next;
+      new_anchor.watermark = old_anchor.watermark + 1;
       if (anchor_.compare_exchange_weak(old_anchor, new_anchor)) {
-        auto& descriptor = GetHeap()->descriptors[old_anchor.head];
+        std::size_t index = old_anchor.watermark;
+        if (auto result = CommitRange(index, 1); result.has_error())
+          return cpp::fail(result.error());
+
+        auto& descriptor = GetHeap()->descriptors[index];
         descriptor.occupied = true;
+        descriptor.in_list = false;
+        descriptor.count = 1;
         descriptor.next = 0;
-        auto ptr =
+        recorder_.RecordFind(internal::GetPageSize());
+        return reinterpret_cast<std::byte*>(
+                   GetHeap()->super_block.address) +
+               index * internal::GetPageSize();
+      }
+
+      recorder_.RecordCasRetry();
+    }
+  }
+
+  // Bulk form of |Provide|. While fresh pages remain at the watermark, one
+  // CAS claims as many single-page blocks as the batch still needs;
+  // remaining entries (multi-page blocks, or a drained watermark) fall back
+  // to the regular path. On failure every block already handed out is
+  // returned before the error surfaces.
+  Result<void> ProvideMany(std::size_t count, std::span<std::byte*> out) {
+    if (count == 0 || count > kLimit || out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t filled = 0;
+    while (count == 1 && filled < out.size()) {
+      auto old_anchor = anchor_.load();
+      if (old_anchor.status == Status::Initial) {
+        if (auto result = InitializeHeap(); result.has_error())
+          return cpp::fail(result.error());
+
+        continue;
+      } else if (old_anchor.status == Status::Allocating) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      std::size_t chunk =
+          std::min<std::size_t>(out.size() - filled,
+                                kLimit - old_anchor.watermark);
+      if (chunk == 0)
+        break;
+
+      auto new_anchor = old_anchor;
+      new_anchor.watermark = old_anchor.watermark + chunk;
+      if (!anchor_.compare_exchange_weak(old_anchor, new_anchor)) {
+        recorder_.RecordCasRetry();
+        continue;
+      }
+
+      std::size_t first = old_anchor.watermark;
+      if (auto result = CommitRange(first, chunk); result.has_error()) {
+        while (filled > 0)
+          (void)Return(out[--filled]);
+
+        return cpp::fail(result.error());
+      }
+
+      for (std::size_t i = 0; i < chunk; ++i) {
+        auto& descriptor = GetHeap()->descriptors[first + i];
+        descriptor.occupied = true;
+        descriptor.in_list = false;
+        descriptor.count = 1;
+        descriptor.next = 0;
+        out[filled + i] =
             reinterpret_cast<std::byte*>(GetHeap()->super_block.address) +
-            old_anchor.head * internal::GetPageSize();
-        return reinterpret_cast<std::byte*>(ptr);
+            (first + i) * internal::GetPageSize();
+      }
+
+      recorder_.RecordFind(chunk * internal::GetPageSize());
+      filled += chunk;
+    }
+
+    for (; filled < out.size(); ++filled) {
+      auto block_or = Provide(count);
+      if (block_or.has_error()) {
+        while (filled > 0)
+          (void)Return(out[--filled]);
+
+        return cpp::fail(block_or.error());
       }
+
+      out[filled] = block_or.value();
     }
+
+    return {};
   }
 
   Result<void> Return(std::byte* p) {
     if (p == nullptr || heap_ == std::nullopt)
       return cpp::fail(Error::InvalidInput);
 
-    auto distance =
-        reinterpret_cast<std::uintptr_t>(p) - GetHeap()->super_block.address;
+    // The superblock is reserved naturally aligned to its own (power of
+    // two) size, so ownership is a single AND-mask: pointers from any
+    // other provider or allocator land on a different base. This lets
+    // callers that fan out over several providers route a Return by
+    // probing them.
+    auto address = reinterpret_cast<std::uintptr_t>(p);
+    if ((address & ~(kSuperBlockSize - 1)) != GetHeap()->super_block.address)
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t index =
+        (address & (kSuperBlockSize - 1)) / internal::GetPageSize();
+
+    // Pages past the watermark were never handed out; their descriptors
+    // are uncommitted and must not be touched.
+    if (index >= anchor_.load().watermark)
+      return cpp::fail(Error::InvalidInput);
+
+    // Runs were chained together at allocation time, so a multi-page Return
+    // is the same single-CAS splice as a single page: only the tail's |next|
+    // needs patching before publishing the new head.
+    std::size_t count = GetHeap()->descriptors[index].count;
+    std::size_t tail = index + count - 1;
 
-    std::size_t index = distance / internal::GetPageSize();
-    GetHeap()->descriptors[index].occupied = false;
+    // Clear the flags before the splice is published. A run scanner only
+    // considers pages it finds on the free list itself, so a page that is
+    // unoccupied but not yet spliced in cannot be handed out twice.
+    for (std::size_t i = index; i <= tail; ++i)
+      GetHeap()->descriptors[i].occupied = false;
 
     while (true) {
       auto old_anchor = anchor_.load();
+      // ProvideRun rewrites the descriptor list while holding the
+      // |Allocating| status, so stay off it until the scan finishes.
+      if (old_anchor.status == Status::Allocating) {
+        std::this_thread::yield();
+        continue;
+      }
+
       auto new_anchor = old_anchor;
       new_anchor.head = index;
-      new_anchor.available = old_anchor.available + 1;
+      new_anchor.available = old_anchor.available + count;
 
       // Eagerly set head here so that if another thread immediately takes
       // this block after the CAS instruction below, the Descriptor entry
       // is in a valid state.
-      GetHeap()->descriptors[index].next = old_anchor.head;
+      GetHeap()->descriptors[tail].next = old_anchor.head;
       if (anchor_.compare_exchange_weak(old_anchor, new_anchor)) {
+        recorder_.RecordReturn(count * internal::GetPageSize());
         return {};
       }
+
+      recorder_.RecordCasRetry();
+    }
+  }
+
+  // Bulk form of |Return| for deferred reclamation. The whole batch is
+  // pre-chained through its descriptors and spliced into the free list
+  // with a single CAS, so a consumer thread that defers its frees into a
+  // local batch pays one contended operation per epoch instead of one per
+  // page. Fails before mutating anything if any pointer is not owned here.
+  Result<void> ReturnMany(std::span<std::byte* const> pages) {
+    if (pages.empty() || heap_ == std::nullopt)
+      return cpp::fail(Error::InvalidInput);
+
+    // Validate every pointer up front so the batch either splices whole
+    // or leaves the heap untouched.
+    std::size_t watermark = anchor_.load().watermark;
+    for (std::byte* p : pages) {
+      auto address = reinterpret_cast<std::uintptr_t>(p);
+      if (p == nullptr ||
+          (address & ~(kSuperBlockSize - 1)) != GetHeap()->super_block.address)
+        return cpp::fail(Error::InvalidInput);
+
+      if ((address & (kSuperBlockSize - 1)) / internal::GetPageSize() >=
+          watermark)
+        return cpp::fail(Error::InvalidInput);
+    }
+
+    // Chain the batch: each entry's tail descriptor points at the next
+    // entry's head, exactly the shape Return leaves a multi-page run in.
+    Heap* heap = GetHeap();
+    std::size_t first = kLimit;
+    std::size_t last_tail = kLimit;
+    std::size_t total = 0;
+    for (std::byte* p : pages) {
+      std::size_t index = (reinterpret_cast<std::uintptr_t>(p) &
+                           (kSuperBlockSize - 1)) /
+                          internal::GetPageSize();
+      std::size_t count = heap->descriptors[index].count;
+      std::size_t tail = index + count - 1;
+
+      for (std::size_t i = index; i <= tail; ++i)
+        heap->descriptors[i].occupied = false;
+
+      if (first == kLimit)
+        first = index;
+      else
+        heap->descriptors[last_tail].next = index;
+
+      last_tail = tail;
+      total += count;
+    }
+
+    while (true) {
+      auto old_anchor = anchor_.load();
+      if (old_anchor.status == Status::Allocating) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      auto new_anchor = old_anchor;
+      new_anchor.head = first;
+      new_anchor.available = old_anchor.available + total;
+
+      heap->descriptors[last_tail].next = old_anchor.head;
+      if (anchor_.compare_exchange_weak(old_anchor, new_anchor)) {
+        recorder_.RecordReturn(total * internal::GetPageSize());
+        return {};
+      }
+
+      recorder_.RecordCasRetry();
     }
   }
 
@@ -105,17 +318,35 @@ public:
     return internal::GetPageSize();
   }
 
+  const Statistics& GetStatistics() const { return recorder_.GetStatistics(); }
+
 private:
   static constexpr std::uint64_t kLimit =
       std::max({kDefaultLimit, ntp::optional<LimitT<0>, Args...>::value});
 
+  // Superblock reservation size in bytes, rounded up to a power of two so
+  // the naturally-aligned reservation makes pointer ownership a mask
+  // comparison (see |Return|). Only address space, not memory.
+  static constexpr std::uint64_t kSuperBlockSize =
+      std::bit_ceil(kLimit * internal::GetPageSize());
+
   // A block descriptor is an entry in the linked list of blocks.
   struct Descriptor {
     // Index of next entry in list.
     std::size_t next;
 
+    // Number of pages in the run starting at this descriptor. Always 1 for
+    // pages handed out individually; set to the requested count on the first
+    // page of a contiguous run so Return can splice the whole run back.
+    std::size_t count;
+
     // Whether this block is currently in use.
     bool occupied;
+
+    // Scratch flag used by |ProvideRun| while it holds the |Allocating|
+    // status to mark free-list membership during its scan. Meaningless
+    // outside that window.
+    bool in_list;
   };
 
   struct alignas(internal::GetPageSize()) Heap {
@@ -135,15 +366,19 @@ private:
    * to high bits.
    *  status: 2 = Status to see if heap has been initialized:
    *    Initial, Allocating, Allocated
-   *  head: 18 = Index of current head of LIFO list.
-   *  available: 18 = Number of pages available for allocation.
-   *    0 if at capacity.
+   *  head: 18 = Index of current head of LIFO list. kLimit when the list is
+   *    empty.
+   *  available: 18 = Number of pages available on the LIFO list.
+   *  watermark: 18 = Index of the first page never handed out. Pages and
+   *    descriptors past the watermark are reserved address space only and
+   *    must be committed before use.
    */
   struct Anchor {
     std::uint64_t status : 2;
     std::uint64_t head : 18;
     std::uint64_t available : 18;
-    std::uint64_t reserved : 26;
+    std::uint64_t watermark : 18;
+    std::uint64_t reserved : 8;
   };
 
   Result<void> InitializeHeap() {
@@ -156,33 +391,206 @@ private:
     if (!anchor_.compare_exchange_weak(old_anchor, new_anchor))
       return {};
 
+    // Only reserve address space here. A fresh page's backing memory — and
+    // the heap page holding its descriptor — is committed the first time
+    // the watermark reaches it, so a process that allocates 10 pages pays
+    // for 10 pages, not the full kLimit.
     auto heap_va_range_or =
-        internal::FetchPages(sizeof(Heap) / internal::GetPageSize());
+        internal::ReservePages(sizeof(Heap) / internal::GetPageSize());
     // TODO: Mapping of internal to user-facing error should be more robust.
     if (heap_va_range_or.has_error())
       return cpp::fail(Error::OutOfMemory);
 
-    auto sb_va_range_or = internal::FetchPages(kLimit);
+    auto sb_va_range_or =
+        internal::ReserveAlignedPages(kLimit, kSuperBlockSize);
     if (sb_va_range_or.has_error())
       return cpp::fail(Error::OutOfMemory);
 
     auto heap_va_range = heap_va_range_or.value();
+
+    // The leading page of the heap holds the superblock range (and the
+    // first descriptors); it is needed on every Provide.
+    if (auto result = internal::CommitPages(internal::VirtualAddressRange{
+            .address = heap_va_range.address, .count = 1});
+        result.has_error())
+      return cpp::fail(Error::OutOfMemory);
+
     Heap* heap = reinterpret_cast<Heap*>(heap_va_range.address);
     heap->super_block = sb_va_range_or.value();
-    for (auto i = 0u; i < kLimit; ++i) {
-      Descriptor& descriptor = heap->descriptors[i];
-      descriptor.occupied = false;
-      descriptor.next = i + 1;
-    }
 
     heap_ = heap_va_range;
 
-    new_anchor.available = kLimit;
+    new_anchor.available = 0;
+    new_anchor.head = kLimit;
+    new_anchor.watermark = 0;
     new_anchor.status = Status::Allocated;
     anchor_.store(new_anchor);
     return {};
   }
 
+  // Commit the superblock pages [index, index + count) together with the
+  // heap pages holding their descriptors. Committing an already-committed
+  // region is harmless, so racing commits of neighboring descriptors that
+  // share a heap page are benign.
+  Result<void> CommitRange(std::size_t index, std::size_t count) {
+    if (auto result = internal::CommitPages(internal::VirtualAddressRange{
+            .address = GetHeap()->super_block.address +
+                       index * internal::GetPageSize(),
+            .count = count});
+        result.has_error())
+      return cpp::fail(Error::OutOfMemory);
+
+    std::size_t begin = internal::AlignDown(
+        offsetof(Heap, descriptors) + index * sizeof(Descriptor),
+        internal::GetPageSize());
+    std::size_t end = internal::AlignUp(
+        offsetof(Heap, descriptors) + (index + count) * sizeof(Descriptor),
+        internal::GetPageSize());
+    if (auto result = internal::CommitPages(internal::VirtualAddressRange{
+            .address = heap_->address + begin,
+            .count = (end - begin) / internal::GetPageSize()});
+        result.has_error())
+      return cpp::fail(Error::OutOfMemory);
+
+    return {};
+  }
+
+  // Hands out |count| physically-consecutive pages. Runs can't be served off
+  // the LIFO head, so this path takes the |Allocating| status as an exclusion
+  // window — single-page Provide and Return spin while it is set — and
+  // performs a first-fit scan over the descriptor list. The run's descriptors
+  // are chained at allocation time so Return can splice the whole run back
+  // with its usual single CAS. Multi-page requests are expected to be rare
+  // (arena setup) relative to the single-page hot path, which is unchanged.
+  Result<std::byte*> ProvideRun(std::size_t count) {
+    while (true) {
+      auto old_anchor = anchor_.load();
+      if (old_anchor.status == Status::Initial) {
+        if (auto result = InitializeHeap(); result.has_error())
+          return cpp::fail(result.error());
+
+        continue;
+      } else if (old_anchor.status == Status::Allocating) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      // Fresh pages at the watermark are contiguous by construction, so
+      // claiming the run there is a single CAS with no scan at all.
+      if (old_anchor.watermark + count <= kLimit) {
+        auto new_anchor = old_anchor;
+        new_anchor.watermark = old_anchor.watermark + count;
+        if (!anchor_.compare_exchange_weak(old_anchor, new_anchor))
+          continue;
+
+        std::size_t first = old_anchor.watermark;
+        if (auto result = CommitRange(first, count); result.has_error())
+          return cpp::fail(result.error());
+
+        for (std::size_t i = first; i < first + count; ++i) {
+          Descriptor& descriptor = GetHeap()->descriptors[i];
+          descriptor.occupied = true;
+          descriptor.in_list = false;
+          descriptor.count = 1;
+          descriptor.next = i + 1 < first + count ? i + 1 : 0;
+        }
+        GetHeap()->descriptors[first].count = count;
+
+        recorder_.RecordFind(count * internal::GetPageSize());
+        return reinterpret_cast<std::byte*>(
+                   GetHeap()->super_block.address) +
+               first * internal::GetPageSize();
+      }
+
+      if (old_anchor.available < count)
+        return cpp::fail(Error::NoFreeBlock);
+
+      auto locked_anchor = old_anchor;
+      locked_anchor.status = Status::Allocating;
+      if (!anchor_.compare_exchange_weak(old_anchor, locked_anchor))
+        continue;
+
+      Heap* heap = GetHeap();
+
+      // Membership in the free list is the ground truth for this scan. The
+      // |occupied| flag alone is not enough: a page mid-Return is already
+      // unoccupied but not yet spliced in, and must not be handed out here.
+      for (std::size_t itr = locked_anchor.head; itr != kLimit;
+           itr = heap->descriptors[itr].next)
+        heap->descriptors[itr].in_list = true;
+
+      // First-fit over page indices for |count| consecutive free pages.
+      // Descriptors past the watermark are uncommitted address space and
+      // must not be read.
+      std::size_t first = kLimit;
+      std::size_t run = 0;
+      for (std::size_t i = 0; i < locked_anchor.watermark; ++i) {
+        if (!heap->descriptors[i].in_list) {
+          run = 0;
+          continue;
+        }
+
+        if (run++ == 0)
+          first = i;
+
+        if (run == count)
+          break;
+      }
+
+      if (run < count)
+        first = kLimit;
+
+      auto in_run = [&](std::size_t index) {
+        return first != kLimit && index >= first && index < first + count;
+      };
+
+      // Unlink run members and clear the scratch flags in one pass.
+      std::size_t new_head = locked_anchor.head;
+      while (new_head != kLimit && in_run(new_head)) {
+        heap->descriptors[new_head].in_list = false;
+        new_head = heap->descriptors[new_head].next;
+      }
+
+      for (std::size_t itr = new_head; itr != kLimit;) {
+        Descriptor& descriptor = heap->descriptors[itr];
+        descriptor.in_list = false;
+        std::size_t next = descriptor.next;
+        while (next != kLimit && in_run(next)) {
+          heap->descriptors[next].in_list = false;
+          next = heap->descriptors[next].next;
+        }
+
+        descriptor.next = next;
+        itr = next;
+      }
+
+      auto final_anchor = locked_anchor;
+      final_anchor.status = Status::Allocated;
+
+      if (first == kLimit) {
+        // No fit. Release the exclusion window before reporting failure.
+        anchor_.store(final_anchor);
+        return cpp::fail(Error::NoFreeBlock);
+      }
+
+      for (std::size_t i = first; i < first + count; ++i) {
+        Descriptor& descriptor = heap->descriptors[i];
+        descriptor.occupied = true;
+        descriptor.count = 1;
+        descriptor.next = i + 1 < first + count ? i + 1 : 0;
+      }
+      heap->descriptors[first].count = count;
+
+      final_anchor.head = new_head;
+      final_anchor.available = locked_anchor.available - count;
+      anchor_.store(final_anchor);
+
+      recorder_.RecordFind(count * internal::GetPageSize());
+      return reinterpret_cast<std::byte*>(heap->super_block.address) +
+             first * internal::GetPageSize();
+    }
+  }
+
   Heap* GetHeap() {
     if (!heap_.has_value())
       return nullptr;
@@ -192,6 +600,9 @@ private:
 
   std::atomic<Anchor> anchor_ = {};
   std::optional<internal::VirtualAddressRange> heap_ = std::nullopt;
+
+  [[no_unique_address]] internal::StatsRecorderFor<kStatisticsEnabled>
+      recorder_;
 };
 
 } // namespace allocators::provider
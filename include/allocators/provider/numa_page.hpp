@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+#include <template/parameters.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/common/trait.hpp>
+#include <allocators/internal/platform.hpp>
+#include <allocators/internal/util.hpp>
+#include <allocators/provider/lock_free_page.hpp>
+
+namespace allocators::provider {
+
+// Parameters for NumaPage class defined below.
+struct NumaPageParams {
+  static constexpr std::size_t kDefaultNodeCount = 8;
+
+  // Sentinel for |PinnedNodeT| meaning "no pin": every thread provides from
+  // its own node.
+  static constexpr std::size_t kNodeUnpinned = static_cast<std::size_t>(-1);
+
+  // Number of node slots, one independent page shard each. Must be a power
+  // of two and no smaller than the machine's NUMA node count; extra slots
+  // simply stay empty.
+  template <std::size_t N>
+  struct NodesT : std::integral_constant<std::size_t, N> {};
+
+  // Pins every Provide to one node regardless of where the calling thread
+  // runs, for partitioned data structures whose consumers live on a known
+  // socket. Ranges handed out to a remote thread are explicitly bound to
+  // the pinned node before they fault.
+  template <std::size_t N>
+  struct PinnedNodeT : std::integral_constant<std::size_t, N> {};
+};
+
+// Provider class that keeps page acquisition local to the calling thread's
+// NUMA node. A single shared provider lets a page fault in on whichever
+// node first touched it, and on multi-socket machines a consumer on the
+// other socket then eats the remote-access latency on every load. Here each
+// node owns an independent |LockFreePage| shard; Provide serves from the
+// shard of the node the caller is running on, so first-touch places the
+// backing memory locally with no syscall on the hot path. Only ranges that
+// will deliberately fault "remotely" — everything handed out in pinned mode
+// to a thread on another node, and ranges stolen from a sibling node once
+// the home shard is exhausted — are bound to their target node via
+// |internal::BindToNumaNode|. Bind failures are ignored; placement then
+// falls back to first-touch, which is the status quo.
+//
+// Remaining parameters (page limit, statistics) pass through to every
+// shard; the page limit is per node. This provider is thread-safe.
+template <class... Args> class NumaPage : public NumaPageParams {
+public:
+  static constexpr std::size_t kNodeCount = std::max(
+      {kDefaultNodeCount, ntp::optional<NodesT<0>, Args...>::value});
+
+  static constexpr std::size_t kPinnedNode =
+      ntp::optional<PinnedNodeT<kNodeUnpinned>, Args...>::value;
+
+  static constexpr bool kPinned = kPinnedNode != kNodeUnpinned;
+
+  NumaPage() = default;
+
+  ALLOCATORS_NO_COPY_NO_MOVE(NumaPage);
+
+  Result<std::byte*> Provide(std::size_t count) {
+    std::size_t home = GetHomeNode();
+    Error last_error = Error::NoFreeBlock;
+    for (std::size_t i = 0; i < kNodeCount; ++i) {
+      auto result = shards_[(home + i) & (kNodeCount - 1)].Provide(count);
+      if (result.has_value()) {
+        BindIfRemote(result.value(), count, home, /*stolen=*/i != 0);
+        return result;
+      }
+
+      // Remote memory beats failure, so exhaustion falls over to a sibling
+      // node; anything else would fail there just the same.
+      if (result.error() != Error::NoFreeBlock &&
+          result.error() != Error::OutOfMemory)
+        return result;
+
+      last_error = result.error();
+    }
+
+    return cpp::fail(last_error);
+  }
+
+  // Bulk form of |Provide|. The whole batch goes to one node's shard so its
+  // single-CAS batch path applies; shards already unwind partial batches,
+  // so falling over to a sibling is safe.
+  Result<void> ProvideMany(std::size_t count, std::span<std::byte*> out) {
+    std::size_t home = GetHomeNode();
+    Error last_error = Error::NoFreeBlock;
+    for (std::size_t i = 0; i < kNodeCount; ++i) {
+      auto result =
+          shards_[(home + i) & (kNodeCount - 1)].ProvideMany(count, out);
+      if (result.has_value()) {
+        for (std::byte* block : out)
+          BindIfRemote(block, count, home, /*stolen=*/i != 0);
+
+        return result;
+      }
+
+      if (result.error() != Error::NoFreeBlock &&
+          result.error() != Error::OutOfMemory)
+        return result;
+
+      last_error = result.error();
+    }
+
+    return cpp::fail(last_error);
+  }
+
+  Result<void> Return(std::byte* p) {
+    if (p == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    // Each shard rejects pointers outside its own superblock, so probing
+    // them in order is safe; only the owner will accept. Start at the home
+    // node since pages are usually freed by the thread that got them.
+    std::size_t home = GetHomeNode();
+    for (std::size_t i = 0; i < kNodeCount; ++i) {
+      if (auto result = shards_[(home + i) & (kNodeCount - 1)].Return(p);
+          result.has_value())
+        return result;
+    }
+
+    return cpp::fail(Error::InvalidInput);
+  }
+
+  [[nodiscard]] static constexpr std::size_t GetBlockSize() {
+    return internal::GetPageSize();
+  }
+
+  // Statistics for one node's shard. Per-node counts show exactly where the
+  // memory lives, so aggregation is left to the caller.
+  const Statistics& GetStatistics(std::size_t node) const {
+    return shards_[node & (kNodeCount - 1)].GetStatistics();
+  }
+
+private:
+  static std::size_t GetHomeNode() {
+    if constexpr (kPinned)
+      return kPinnedNode;
+
+    return internal::GetCurrentNumaNode() & (kNodeCount - 1);
+  }
+
+  // Binds |count| pages at |block| to |home| when they would otherwise
+  // fault on the wrong node: in pinned mode whenever the caller runs
+  // elsewhere, and in either mode when the range was stolen from a sibling
+  // shard and is about to be first-touched here. The common case — a thread
+  // providing from its own node's shard — issues no syscall at all.
+  static void BindIfRemote(std::byte* block, std::size_t count,
+                           std::size_t home, bool stolen) {
+    if constexpr (kPinned) {
+      if (!stolen && internal::GetCurrentNumaNode() == kPinnedNode)
+        return;
+    } else {
+      if (!stolen)
+        return;
+    }
+
+    auto address = reinterpret_cast<std::uint64_t>(block);
+    while (count > 0) {
+      std::size_t chunk = std::min<std::size_t>(
+          count, internal::VirtualAddressRange::kMaxPageCount);
+      (void)internal::BindToNumaNode(
+          internal::VirtualAddressRange{.address = address, .count = chunk},
+          home);
+      address += chunk * internal::GetPageSize();
+      count -= chunk;
+    }
+  }
+
+  // Various assertions hidden from user API but added here to ensure
+  // invariants are met at compile time.
+  static_assert(internal::IsPowerOfTwo(kNodeCount),
+                "kNodeCount must be a power of 2.");
+  static_assert(!kPinned || kPinnedNode < kNodeCount,
+                "kPinnedNode must name one of the kNodeCount node slots.");
+
+  std::array<LockFreePage<Args...>, kNodeCount> shards_;
+};
+
+} // namespace allocators::provider
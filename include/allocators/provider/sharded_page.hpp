@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <thread>
+
+#include <template/parameters.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/common/trait.hpp>
+#include <allocators/internal/util.hpp>
+#include <allocators/provider/lock_free_page.hpp>
+
+namespace allocators::provider {
+
+// Parameters for ShardedPage class defined below.
+struct ShardedPageParams {
+  static constexpr std::size_t kDefaultShardCount = 8;
+
+  // Number of independent page-provider shards. Must be a power of two.
+  // More shards mean less anchor contention but more reserved address
+  // space. A good starting point is the machine's core count.
+  template <std::size_t N>
+  struct ShardsT : std::integral_constant<std::size_t, N> {};
+};
+
+// Provider class that spreads page acquisition over an array of independent
+// |LockFreePage| shards. A single LockFreePage funnels every Provide and
+// Return through one atomic anchor, and at high core counts that cache line
+// bounces between sockets hard enough that throughput *drops* as threads
+// are added. Here each thread hashes to a home shard, so under steady load
+// concurrent threads CAS against different cache lines; when a shard's
+// pages run dry the caller steals from the siblings in order. Each shard
+// owns a disjoint superblock, which keeps Return routing a simple range
+// probe — the owning shard accepts, every other shard rejects.
+//
+// Remaining parameters (page limit, statistics) pass through to every
+// shard; note the page limit is per shard, so total capacity scales with
+// the shard count. This provider is thread-safe.
+template <class... Args> class ShardedPage : public ShardedPageParams {
+public:
+  static constexpr std::size_t kShardCount = std::max(
+      {kDefaultShardCount, ntp::optional<ShardsT<0>, Args...>::value});
+
+  ShardedPage() = default;
+
+  ALLOCATORS_NO_COPY_NO_MOVE(ShardedPage);
+
+  Result<std::byte*> Provide(std::size_t count) {
+    std::size_t home = GetHomeShard();
+    Error last_error = Error::NoFreeBlock;
+    for (std::size_t i = 0; i < kShardCount; ++i) {
+      auto result = shards_[(home + i) & (kShardCount - 1)].Provide(count);
+      if (result.has_value())
+        return result;
+
+      // Only exhaustion justifies stealing from a sibling shard; anything
+      // else would fail there just the same.
+      if (result.error() != Error::NoFreeBlock &&
+          result.error() != Error::OutOfMemory)
+        return result;
+
+      last_error = result.error();
+    }
+
+    return cpp::fail(last_error);
+  }
+
+  // Bulk form of |Provide|. The whole batch goes to one shard so its
+  // single-CAS batch path applies; shards already unwind partial batches,
+  // so falling over to a sibling is safe.
+  Result<void> ProvideMany(std::size_t count, std::span<std::byte*> out) {
+    std::size_t home = GetHomeShard();
+    Error last_error = Error::NoFreeBlock;
+    for (std::size_t i = 0; i < kShardCount; ++i) {
+      auto result =
+          shards_[(home + i) & (kShardCount - 1)].ProvideMany(count, out);
+      if (result.has_value())
+        return result;
+
+      if (result.error() != Error::NoFreeBlock &&
+          result.error() != Error::OutOfMemory)
+        return result;
+
+      last_error = result.error();
+    }
+
+    return cpp::fail(last_error);
+  }
+
+  Result<void> Return(std::byte* p) {
+    if (p == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    // Each shard rejects pointers outside its own superblock, so probing
+    // them in order is safe; only the owner will accept. Start at the home
+    // shard since pages are usually freed by the thread that got them.
+    std::size_t home = GetHomeShard();
+    for (std::size_t i = 0; i < kShardCount; ++i) {
+      if (auto result = shards_[(home + i) & (kShardCount - 1)].Return(p);
+          result.has_value())
+        return result;
+    }
+
+    return cpp::fail(Error::InvalidInput);
+  }
+
+  [[nodiscard]] static constexpr std::size_t GetBlockSize() {
+    return internal::GetPageSize();
+  }
+
+  // Statistics for one shard. Aggregation is left to the caller since
+  // per-shard counts are exactly what contention tuning needs.
+  const Statistics& GetStatistics(std::size_t shard) const {
+    return shards_[shard & (kShardCount - 1)].GetStatistics();
+  }
+
+private:
+  static std::size_t GetHomeShard() {
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) &
+           (kShardCount - 1);
+  }
+
+  // Various assertions hidden from user API but added here to ensure
+  // invariants are met at compile time.
+  static_assert(internal::IsPowerOfTwo(kShardCount),
+                "kShardCount must be a power of 2.");
+
+  std::array<LockFreePage<Args...>, kShardCount> shards_;
+};
+
+} // namespace allocators::provider
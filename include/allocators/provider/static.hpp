@@ -1,44 +1,122 @@
 #pragma once
 
+#include <bitset>
+#include <cstddef>
+#include <span>
+
 #include <template/parameters.hpp>
 
 #include <allocators/common/error.hpp>
+#include <allocators/internal/util.hpp>
 
 namespace allocators::provider {
 
-// Provider class that reserves memory static data instead of
-// fetching it from the heap. This is useful if a user wants to
-// leverage the various Strategy algorithms on statically-allocated
-// memory over that fetched from the heap.
-// The |Size| parameter specifies how much memory to reserve.
-// Note, the size can be too large, and its up to the user of
-// this class to restrict the upper bound size.
-template <std::size_t Size, class... Args> class Static {
+// Provider class that reserves memory in static data instead of fetching
+// it from the heap. This is useful if a user wants to leverage the various
+// Strategy algorithms on statically-reserved memory over that fetched from
+// the heap — embedded and firmware builds in particular, where the full
+// strategy stack runs with zero syscalls and deterministic worst-case
+// latency.
+// The buffer is carved into |N| blocks of |Size| bytes each, with
+// occupancy tracked in a constexpr-sized bitmap. |Provide| hands out
+// contiguous runs of blocks found by a bounded first-fit scan, so a
+// multi-block strategy heap grows past a single region just as it would on
+// a page provider.
+// Note, |Size| and |N| can be too large, and it's up to the user of this
+// class to restrict the upper bound.
+template <std::size_t Size, std::size_t N = 1, class... Args> class Static {
 public:
   Static() = default;
 
   ALLOCATORS_NO_COPY_NO_MOVE(Static);
 
   Result<std::byte*> Provide(std::size_t count) {
-    if (count != 1)
+    if (count == 0 || count > N)
       return cpp::fail(Error::InvalidInput);
 
-    return AsPtr();
+    // Bounded first-fit over the occupancy bitmap. N is a compile-time
+    // constant, so the worst case is fixed and known.
+    std::size_t run = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      if (occupied_[i]) {
+        run = 0;
+        continue;
+      }
+
+      if (++run < count)
+        continue;
+
+      std::size_t first = i + 1 - count;
+      for (std::size_t j = first; j <= i; ++j)
+        occupied_.set(j);
+
+      run_length_[first] = count;
+      return AsPtr(first);
+    }
+
+    return cpp::fail(Error::NoFreeBlock);
+  }
+
+  // Bulk form of |Provide|. There is no synchronization here to amortize,
+  // so this is a convenience loop; on failure every block already handed
+  // out is returned before the error surfaces.
+  Result<void> ProvideMany(std::size_t count, std::span<std::byte*> out) {
+    if (out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      auto block_or = Provide(count);
+      if (block_or.has_error()) {
+        while (i > 0)
+          (void)Return(out[--i]);
+
+        return cpp::fail(block_or.error());
+      }
+
+      out[i] = block_or.value();
+    }
+
+    return {};
   }
 
   Result<void> Return(std::byte* ptr) {
-    if (ptr != AsPtr())
+    if (ptr < AsPtr(0) || ptr >= AsPtr(N))
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t offset = static_cast<std::size_t>(ptr - AsPtr(0));
+    if (offset % Size != 0)
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t first = offset / Size;
+
+    // A block that was never handed out (or was already returned) has no
+    // recorded run length.
+    std::size_t count = run_length_[first];
+    if (count == 0)
       return cpp::fail(Error::InvalidInput);
 
+    for (std::size_t i = first; i < first + count; ++i)
+      occupied_.reset(i);
+
+    run_length_[first] = 0;
     return {};
   }
 
-  constexpr std::size_t GetBlockSize() const { return Size; };
+  [[nodiscard]] static constexpr std::size_t GetBlockSize() { return Size; };
 
 private:
-  std::byte* AsPtr() { return &block_[0]; }
+  std::byte* AsPtr(std::size_t index) { return &block_[index * Size]; }
+
+  // Blocks handed to strategies must satisfy the library's minimum
+  // alignment no matter what |Size| is.
+  alignas(alignof(std::max_align_t)) std::byte block_[Size * N] = {
+      std::byte(0)};
+
+  std::bitset<N> occupied_;
 
-  std::byte block_[Size] = {std::byte(0)};
+  // Number of blocks in the run starting at each index; zero when the
+  // index is not the head of a live run.
+  std::size_t run_length_[N] = {0};
 };
 
 } // namespace allocators::provider
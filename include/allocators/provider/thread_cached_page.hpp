@@ -0,0 +1,264 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <span>
+
+#include <template/parameters.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/common/trait.hpp>
+#include <allocators/internal/util.hpp>
+
+namespace allocators::provider {
+
+// Parameters for ThreadCachedPage class defined below.
+struct ThreadCachedPageParams {
+  static constexpr std::size_t kDefaultMagazineCapacity = 16;
+
+  // Number of pages each thread may stash locally before flushing back to
+  // the underlying provider. Larger magazines remove more contention at the
+  // cost of more memory parked in idle threads.
+  template <std::size_t N>
+  struct MagazineCapacityT : std::integral_constant<std::size_t, N> {};
+};
+
+// Provider class that layers a small per-thread cache of pages, a
+// "magazine", over an underlying provider such as |LockFreePage|. Provide
+// and Return are served from the calling thread's magazine without touching
+// any shared state; only when the magazine runs empty (or fills up) does the
+// thread refill (or flush) half of it from the underlying provider in a
+// batch. This keeps the common Provide/Return pair off the shared anchor
+// CAS entirely, which otherwise dominates at high core counts.
+//
+// The underlying provider must outlive every thread using this class, since
+// magazines drain back to it on thread exit. The instance keeps a registry
+// of the magazines bound to it and its destructor drains and unbinds them,
+// so the instance itself may be destroyed before thread exit — provided no
+// thread is concurrently calling into it. Pages cached by a thread are
+// invisible to the others until flushed.
+template <class Provider, class... Args>
+requires ProviderTrait<Provider>
+class ThreadCachedPage : public ThreadCachedPageParams {
+public:
+  static constexpr std::size_t kMagazineCapacity =
+      std::max({kDefaultMagazineCapacity,
+                ntp::optional<MagazineCapacityT<0>, Args...>::value});
+
+  explicit ThreadCachedPage(Provider& provider) : provider_(provider) {}
+
+  // Thread-local magazines hold a pointer back to this instance; drain
+  // and unbind every one still registered so a later thread exit (or a
+  // rebind to another instance) doesn't flush into a destroyed provider.
+  ~ThreadCachedPage() {
+    std::scoped_lock lock(registry_mutex_);
+    for (Magazine* magazine = registry_head_; magazine != nullptr;) {
+      Magazine* next = magazine->next;
+      (void)Flush(*magazine, magazine->size);
+      magazine->owner = nullptr;
+      magazine->next = nullptr;
+      magazine = next;
+    }
+
+    registry_head_ = nullptr;
+  }
+
+  ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(ThreadCachedPage);
+
+  Result<std::byte*> Provide(std::size_t count) {
+    if (count == 0)
+      return cpp::fail(Error::InvalidInput);
+
+    // Only single-page requests benefit from the magazine. Forward anything
+    // else to the underlying provider untouched.
+    if (count != 1)
+      return provider_.get().Provide(count);
+
+    Magazine& magazine = GetMagazine();
+    if (magazine.size == 0) {
+      if (auto result = Refill(magazine); result.has_error())
+        return cpp::fail(result.error());
+    }
+
+    return magazine.slots[--magazine.size];
+  }
+
+  // Bulk form of |Provide|. Entries are served from the magazine while it
+  // lasts; the remainder goes to the underlying provider's own bulk call,
+  // which amortizes its synchronization over what is left. On failure the
+  // magazine pages already handed out are returned before the error
+  // surfaces.
+  Result<void> ProvideMany(std::size_t count, std::span<std::byte*> out) {
+    if (count == 0 || out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    if (count != 1)
+      return provider_.get().ProvideMany(count, out);
+
+    Magazine& magazine = GetMagazine();
+    std::size_t filled = 0;
+    while (filled < out.size() && magazine.size > 0)
+      out[filled++] = magazine.slots[--magazine.size];
+
+    if (filled == out.size())
+      return {};
+
+    if (auto result =
+            provider_.get().ProvideMany(count, out.subspan(filled));
+        result.has_error()) {
+      while (filled > 0)
+        (void)Return(out[--filled]);
+
+      return cpp::fail(result.error());
+    }
+
+    return {};
+  }
+
+  Result<void> Return(std::byte* p) {
+    if (p == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    Magazine& magazine = GetMagazine();
+    if (magazine.size == kMagazineCapacity) {
+      if (auto result = Flush(magazine, kBatchSize); result.has_error())
+        return cpp::fail(result.error());
+    }
+
+    magazine.slots[magazine.size++] = p;
+    return {};
+  }
+
+  // Epoch-boundary hook: drains the calling thread's entire magazine back
+  // to the underlying provider in one batch. Pipelines that defer their
+  // frees call this at phase boundaries so the consumer's latency path
+  // stays free of shared-state contention between epochs.
+  Result<void> Flush() {
+    Magazine& magazine = GetMagazine();
+    return Flush(magazine, magazine.size);
+  }
+
+  [[nodiscard]] static constexpr std::size_t GetBlockSize() {
+    return Provider::GetBlockSize();
+  }
+
+private:
+  // Refills and flushes move half a magazine at a time so a thread
+  // alternating between Provide and Return near the boundary doesn't
+  // round-trip to the underlying provider on every call.
+  static constexpr std::size_t kBatchSize = kMagazineCapacity / 2;
+
+  struct Magazine {
+    ThreadCachedPage* owner = nullptr;
+    Magazine* next = nullptr;
+    std::size_t size = 0;
+    std::array<std::byte*, kMagazineCapacity> slots = {nullptr};
+
+    ~Magazine() {
+      if (owner)
+        owner->Detach(*this);
+    }
+  };
+
+  // Each thread owns one magazine per instantiated type. If a second
+  // instance starts using the same thread, the magazine drains back to its
+  // previous owner before rebinding so pages never cross providers.
+  Magazine& GetMagazine() {
+    static thread_local Magazine magazine;
+    if (magazine.owner != this) {
+      if (magazine.owner)
+        magazine.owner->Detach(magazine);
+
+      magazine.owner = this;
+      std::scoped_lock lock(registry_mutex_);
+      magazine.next = registry_head_;
+      registry_head_ = &magazine;
+    }
+
+    return magazine;
+  }
+
+  // Drains |magazine| back to the underlying provider and severs its link
+  // to this instance.
+  void Detach(Magazine& magazine) {
+    (void)Flush(magazine, magazine.size);
+
+    std::scoped_lock lock(registry_mutex_);
+    if (registry_head_ == &magazine) {
+      registry_head_ = magazine.next;
+    } else {
+      for (Magazine* itr = registry_head_; itr != nullptr; itr = itr->next) {
+        if (itr->next == &magazine) {
+          itr->next = magazine.next;
+          break;
+        }
+      }
+    }
+
+    magazine.next = nullptr;
+    magazine.owner = nullptr;
+  }
+
+  Result<void> Refill(Magazine& magazine) {
+    while (magazine.size < kBatchSize) {
+      auto page_or = provider_.get().Provide(1);
+      if (page_or.has_error()) {
+        // A partial refill is still progress; only fail if the underlying
+        // provider gave us nothing at all.
+        if (magazine.size > 0)
+          return {};
+
+        return cpp::fail(page_or.error());
+      }
+
+      magazine.slots[magazine.size++] = page_or.value();
+    }
+
+    return {};
+  }
+
+  Result<void> Flush(Magazine& magazine, std::size_t count) {
+    count = std::min(count, magazine.size);
+    if (count == 0)
+      return {};
+
+    // Providers with a batched return (e.g. |LockFreePage::ReturnMany|)
+    // splice the whole flush in one CAS; this is where the magazine turns
+    // N contended returns into one per batch.
+    if constexpr (requires(Provider & p, std::span<std::byte* const> batch) {
+                    { p.ReturnMany(batch) } -> std::same_as<Result<void>>;
+                  }) {
+      std::span<std::byte* const> batch(
+          magazine.slots.data() + magazine.size - count, count);
+      if (auto result = provider_.get().ReturnMany(batch); result.has_error())
+        return result;
+
+      magazine.size -= count;
+      return {};
+    } else {
+      while (count-- > 0 && magazine.size > 0) {
+        if (auto result =
+                provider_.get().Return(magazine.slots[magazine.size - 1]);
+            result.has_error())
+          return cpp::fail(result.error());
+
+        --magazine.size;
+      }
+
+      return {};
+    }
+  }
+
+  // Backing provider used to refill and flush magazines.
+  std::reference_wrapper<Provider> provider_;
+
+  // Intrusive list of the magazines currently bound to this instance, so
+  // the destructor can drain and unbind them. Only touched on bind,
+  // detach, and destruction — never on the cached Provide/Return path.
+  Magazine* registry_head_ = nullptr;
+  std::mutex registry_mutex_;
+};
+
+} // namespace allocators::provider
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include <allocators/common/error.hpp>
 #include <allocators/internal/block_map.hpp>
@@ -43,6 +46,28 @@ public:
     return internal::ToBytePtr(va_range.address);
   }
 
+  // Bulk form of |Provide|. There is no synchronization here to amortize,
+  // so this is a convenience loop; on failure every block already handed
+  // out is returned before the error surfaces.
+  Result<void> ProvideMany(std::size_t count, std::span<std::byte*> out) {
+    if (out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      auto block_or = Provide(count);
+      if (block_or.has_error()) {
+        while (i > 0)
+          (void)Return(out[--i]);
+
+        return cpp::fail(block_or.error());
+      }
+
+      out[i] = block_or.value();
+    }
+
+    return {};
+  }
+
   Result<void> Return(std::byte* bytes) {
     if (bytes == nullptr) [[unlikely]]
       return cpp::fail(Error::InvalidInput);
@@ -64,6 +89,66 @@ public:
     return cpp::fail(Error::InvalidInput);
   }
 
+  // Releases every outstanding page and the map pages themselves in bulk.
+  // Instead of one probe plus one munmap per page, the BlockMap chain is
+  // drained directly and physically-contiguous ranges are merged, so
+  // tearing down an arena of 100K pages costs a handful of syscalls
+  // rather than one each. The provider is empty and reusable afterwards.
+  Result<void> ReleaseAll() {
+    if (head_ == nullptr)
+      return {};
+
+    // Teardown is the one path where a transient heap allocation is
+    // acceptable: the ranges must be sorted by address to find adjacency.
+    std::vector<internal::VirtualAddressRange> ranges;
+    for (BlockMap* itr = head_; itr != nullptr; itr = itr->GetNext()) {
+      itr->ForEach([&ranges](internal::VirtualAddressRange va_range) {
+        ranges.push_back(va_range);
+      });
+
+      ranges.push_back(internal::VirtualAddressRange{
+          .address = internal::FromBytePtr<std::uint64_t>(
+              reinterpret_cast<std::byte*>(itr)),
+          .count = 1});
+    }
+
+    head_ = nullptr;
+
+    std::sort(ranges.begin(), ranges.end(),
+              [](const internal::VirtualAddressRange& lhs,
+                 const internal::VirtualAddressRange& rhs) {
+                return lhs.address < rhs.address;
+              });
+
+    bool failed = false;
+    auto release = [&failed](internal::VirtualAddressRange va_range) {
+      if (internal::ReturnPages(va_range).has_error())
+        failed = true;
+    };
+
+    std::size_t page_size = internal::GetPageSize();
+    internal::VirtualAddressRange merged = ranges.front();
+    for (std::size_t i = 1; i < ranges.size(); ++i) {
+      const auto& next = ranges[i];
+      std::size_t combined = merged.count + next.count;
+      if (merged.address + merged.count * page_size == next.address &&
+          combined <= internal::VirtualAddressRange::kMaxPageCount) {
+        merged.count = combined;
+        continue;
+      }
+
+      release(merged);
+      merged = next;
+    }
+
+    release(merged);
+
+    if (failed)
+      return cpp::fail(Error::Internal);
+
+    return {};
+  }
+
   static constexpr std::size_t GetBlockSize() {
     return internal::GetPageSize();
   }
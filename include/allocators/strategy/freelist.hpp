@@ -1,18 +1,22 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 #include <functional>
+#include <span>
 
 #include <template/optional.hpp>
 
 #include <allocators/common/error.hpp>
+#include <allocators/common/stats.hpp>
 #include <allocators/common/trait.hpp>
 #include <allocators/internal/block.hpp>
+#include <allocators/internal/occupancy_map.hpp>
 #include <allocators/internal/util.hpp>
 
 namespace allocators::strategy {
 
-struct FreeListParams {
+struct FreeListParams : StatsParams {
   // Alignment used when making an allocation. Usually, allocators defer to the
   // alignment of the underlying object they are allocating. The constrains for
   // this value are that it is a power of two and greater than |sizeof(void*)|.
@@ -32,10 +36,29 @@ struct FreeListParams {
   };
 
   template <FindBy FB> struct SearchT : std::integral_constant<FindBy, FB> {};
+
+  // When enabled, every provider block carries an occupancy bitmap and
+  // Return validates its pointer with a single bit test: double frees and
+  // in-range pointers that never began an allocation are rejected with
+  // |InvalidInput| before any list state is touched. The cost is one bit
+  // flip per Find/Return and a small slice of each block's capacity —
+  // cheap enough to leave on in canary deployments, not just debug
+  // builds.
+  template <bool Enabled>
+  struct ValidationT : std::integral_constant<bool, Enabled> {};
 };
 
 // Freelist allocator with tunable parameters. For reference as
 // to how to configure, see "common/parameters.hpp".
+//
+// Backing memory is a chain of provider blocks acquired on demand: when
+// the free list cannot satisfy a request, another block is fetched from
+// the provider and linked in through |BlockHeader::next|, and a block
+// whose contents coalesce back into one free chunk is handed back on
+// Return — so held memory tracks live data rather than peak demand.
+// Requests too large for a single provider block bypass the heap and map
+// directly onto a dedicated multi-block provider run (see |FindLarge|),
+// so one instance serves the full size spectrum.
 template <class Provider, class... Args>
 requires ProviderTrait<Provider>
 class FreeList : public FreeListParams {
@@ -46,6 +69,12 @@ public:
   static constexpr FindBy kSearchStrategy =
       ntp::optional<SearchT<FindBy::BestFit>, Args...>::value;
 
+  static constexpr bool kStatisticsEnabled =
+      ntp::optional<StatisticsT<false>, Args...>::value;
+
+  static constexpr bool kValidationEnabled =
+      ntp::optional<ValidationT<false>, Args...>::value;
+
   FreeList(Provider& provider) : provider_(provider) {}
 
   ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(FreeList);
@@ -54,90 +83,222 @@ public:
     if (!IsValid(layout))
       return cpp::fail(Error::InvalidInput);
 
-    std::size_t request_size = internal::AlignUp(
-        layout.size + internal::GetBlockHeaderSize(), layout.alignment);
+    std::size_t request_size =
+        internal::AlignUp(layout.size + internal::GetBlockHeaderSize() +
+                              internal::GetBlockFooterSize(),
+                          layout.alignment);
 
-    if (request_size > GetAlignedSize())
-      return cpp::fail(Error::SizeRequestTooLarge);
+    if (request_size > GetMaxRequestSize())
+      return FindLarge(layout);
 
-    if (auto init = InitBlockIfUnset(); init.has_error())
-      return cpp::fail(init.error());
+    return FindBySize(request_size, layout.alignment);
+  }
 
-    internal::Failable<std::optional<internal::HeaderPair>> first_fit_or_error =
-        GetFindBlockFn()(free_list_, request_size);
-    if (first_fit_or_error.has_error())
-      return cpp::fail(Error::Internal);
+  Result<std::byte*> Find(std::size_t size) noexcept {
+    return Find(Layout(size, internal::kMinimumAlignment));
+  }
 
-    std::optional<internal::HeaderPair> first_fit_or =
-        first_fit_or_error.value();
-    if (!first_fit_or.has_value())
-      return cpp::fail(Error::NoFreeBlock);
+  // Compile-time-layout overload for call sites allocating a type whose
+  // size and alignment are constants — the overwhelmingly common case.
+  // Validation, the header/footer align-up, and the block-size bound all
+  // resolve at compile time (an oversized request dispatches straight to
+  // the large-object path), leaving only the list search itself.
+  template <std::size_t Size,
+            std::size_t Alignment = internal::kMinimumAlignment>
+  Result<std::byte*> Find() noexcept {
+    static_assert(Size > 0, "Size must be nonzero.");
+    static_assert(internal::IsValidAlignment(Alignment),
+                  "Alignment must be a power of 2 no smaller than "
+                  "kMinimumAlignment.");
+
+    constexpr std::size_t kRequestSize =
+        internal::AlignUp(Size + internal::GetBlockHeaderSize() +
+                              internal::GetBlockFooterSize(),
+                          Alignment);
+    if constexpr (kRequestSize > GetMaxRequestSize())
+      return FindLarge(Layout(Size, Alignment));
+    else
+      return FindBySize(kRequestSize, Alignment);
+  }
 
-    auto first_fit = first_fit_or.value();
-    auto new_header_or =
-        internal::SplitBlock(first_fit.header, request_size, layout.alignment);
+  // Bulk allocation. The freelist has no synchronization to amortize, so
+  // this is a convenience loop; on failure every block handed out so far
+  // is returned before the error surfaces.
+  Result<void> FindMany(Layout layout, std::span<std::byte*> out) noexcept {
+    if (out.empty())
+      return cpp::fail(Error::InvalidInput);
 
-    // TODO: This should never occur. Also, if it is in fact possible,
-    // we should log the error before dropping it on the ground.
-    if (new_header_or.has_error())
-      return cpp::fail(Error::Internal);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      auto block_or = Find(layout);
+      if (block_or.has_error()) {
+        while (i > 0)
+          (void)Return(out[--i]);
 
-    auto new_header = new_header_or.value();
-    if (first_fit.header == free_list_)
-      free_list_ = new_header;
-    else if (first_fit.prev)
-      first_fit.prev->next = new_header;
+        return cpp::fail(block_or.error());
+      }
 
-    first_fit.header->next = nullptr;
-    return internal::AsBytePtr(first_fit.header) +
-           internal::GetBlockHeaderSize();
+      out[i] = block_or.value();
+    }
+
+    return {};
   }
 
-  Result<std::byte*> Find(std::size_t size) noexcept {
-    return Find(Layout(size, internal::kMinimumAlignment));
+  // Resizes the allocation at |ptr| in place where physically possible.
+  // Growth absorbs a free physical successor, located through the heap
+  // tiling in constant time just as Return's coalescing does; shrinking
+  // trims the tail back onto the free list. Only when the successor is
+  // occupied, absent, or too small does this fall back to
+  // allocate-copy-return, in which case the returned pointer differs from
+  // |ptr| and the old block has been returned.
+  Result<std::byte*> Resize(std::byte* ptr, std::size_t new_size) {
+    if (ptr == nullptr || new_size == 0)
+      return cpp::fail(Error::InvalidInput);
+
+    auto* owner = FindOwningBlock(ptr);
+    if (owner == nullptr)
+      return ResizeLarge(ptr, new_size);
+
+    if constexpr (kValidationEnabled) {
+      if (!GetOccupancyMap(owner)->IsMarked(
+              static_cast<std::size_t>(ptr - internal::AsBytePtr(owner))))
+        return cpp::fail(Error::InvalidInput);
+    }
+
+    // An oversized target falls through both in-place attempts below and
+    // lands on allocate-copy-return, where Find dispatches to the
+    // large-object path.
+    std::size_t request_size =
+        internal::AlignUp(new_size + internal::GetBlockHeaderSize() +
+                              internal::GetBlockFooterSize(),
+                          internal::kMinimumAlignment);
+
+    auto* block = internal::GetHeader(ptr);
+    std::byte* heap_end = internal::AsBytePtr(owner) + owner->size;
+
+    if (request_size <= block->size) {
+      TrimBlock(block, request_size, heap_end);
+      return ptr;
+    }
+
+    // Grow: the physical successor's header sits directly past this block,
+    // and its boundary tag says whether it is free. Absorbing it keeps the
+    // payload where it is; any excess is trimmed straight back off.
+    if (internal::AsBytePtr(block) + block->size < heap_end) {
+      auto* successor = reinterpret_cast<internal::BlockHeader*>(
+          internal::AsBytePtr(block) + block->size);
+      auto* footer = internal::GetFooter(successor);
+      if (footer->IsFree() && footer->GetSize() == successor->size &&
+          block->size + successor->size >= request_size) {
+        Unlink(successor);
+        block->size += successor->size;
+        TrimBlock(block, request_size, heap_end);
+        internal::WriteFooter(block, /*free=*/false);
+        return ptr;
+      }
+    }
+
+    // The neighbor is occupied (or there is none): allocate-copy-return.
+    std::size_t old_payload = block->size - internal::GetBlockHeaderSize() -
+                              internal::GetBlockFooterSize();
+    auto moved_or = Find(new_size);
+    if (moved_or.has_error())
+      return cpp::fail(moved_or.error());
+
+    std::memcpy(moved_or.value(), ptr, std::min(old_payload, new_size));
+    (void)Return(ptr);
+    return moved_or;
   }
 
   Result<void> Return(std::byte* ptr) {
     if (ptr == nullptr)
       return cpp::fail(Error::InvalidInput);
 
-    std::byte* low = reinterpret_cast<std::byte*>(block_);
-    std::byte* high = reinterpret_cast<std::byte*>(block_) + block_->size;
-    if (ptr < low || ptr > high)
+    auto* owner = FindOwningBlock(ptr);
+    if (owner == nullptr) {
+      // Not in the heap chain: either a large passthrough block, released
+      // back to the provider whole, or a pointer we never handed out.
+      if (auto* large = FindLargeBlock(ptr))
+        return ReleaseLargeBlock(large);
+
       return cpp::fail(Error::InvalidInput);
+    }
+
+    // Clearing the occupancy bit doubles as the check: a double free or a
+    // pointer that never began an allocation finds its bit already clear,
+    // and is rejected before any header is trusted.
+    if constexpr (kValidationEnabled) {
+      if (!GetOccupancyMap(owner)->Clear(
+              static_cast<std::size_t>(ptr - internal::AsBytePtr(owner))))
+        return cpp::fail(Error::InvalidInput);
+    }
 
     auto block = internal::GetHeader(ptr);
-    if (!free_list_) {
-      // TODO: Should we zero out the content here?
-      free_list_ = block;
-      return {};
+    recorder_.RecordReturn(block->size);
+
+    std::byte* heap_begin = internal::AsBytePtr(owner) +
+                            internal::GetBlockHeaderSize() +
+                            GetValidationReserve();
+    std::byte* heap_end = internal::AsBytePtr(owner) + owner->size;
+
+    // The heap is fully tiled by blocks, so the physical successor's header
+    // sits directly past this block and the physical predecessor's boundary
+    // tag sits directly before it. Both neighbors are reachable and, when
+    // free, unlinked in constant time — no list walk.
+    if (internal::AsBytePtr(block) + block->size < heap_end) {
+      auto* successor = reinterpret_cast<internal::BlockHeader*>(
+          internal::AsBytePtr(block) + block->size);
+      auto* footer = internal::GetFooter(successor);
+      if (footer->IsFree() && footer->GetSize() == successor->size) {
+        Unlink(successor);
+        block->size += successor->size;
+      }
     }
 
-    auto prior_or = internal::FindPriorBlock(free_list_, block);
-    // TODO: Add better error here. When will this happen?
-    if (prior_or.has_error())
-      return {};
+    if (internal::AsBytePtr(block) > heap_begin) {
+      auto* footer = internal::GetPrecedingFooter(block);
+      if (footer->IsFree()) {
+        auto* predecessor = reinterpret_cast<internal::BlockHeader*>(
+            internal::AsBytePtr(block) - footer->GetSize());
+        if (internal::AsBytePtr(predecessor) >= heap_begin &&
+            predecessor->size == footer->GetSize()) {
+          Unlink(predecessor);
+          predecessor->size += block->size;
+          block = predecessor;
+        }
+      }
+    }
 
-    auto prior = prior_or.value();
-    if (prior) {
-      auto next = prior->next;
-      prior->next = block;
-      block->next = next;
-      if (auto result = internal::CoalesceBlock(prior); result.has_error())
-        return cpp::fail(Error::Internal);
-    } else {
-      block->next = free_list_;
-      free_list_ = block;
-      if (auto result = internal::CoalesceBlock(free_list_); result.has_error())
-        return cpp::fail(Error::Internal);
+    // A chunk spanning its whole provider block means nothing in that
+    // block is live anymore: unlink the block from the chain and hand it
+    // back instead of filing the chunk.
+    if (internal::AsBytePtr(block) == heap_begin &&
+        block->size == owner->size - internal::GetBlockHeaderSize() -
+                           GetValidationReserve()) {
+      UnlinkBlock(owner);
+      return ReleaseBlock(owner);
     }
 
-    if (free_list_->size == GetAlignedSize()) {
-      // TODO: Add error handling.
-      (void)ReleaseAllBlocks(block_);
-      // free_list_ = block_ = nullptr;
+    PushFront(block);
+    internal::WriteFooter(block, /*free=*/true);
+    return {};
+  }
+
+  Result<void> Reset() {
+    while (large_list_) {
+      if (auto result = ReleaseLargeBlock(large_list_); result.has_error())
+        return result;
     }
 
+    if (!block_)
+      return {};
+
+    while (free_list_)
+      Unlink(free_list_);
+
+    if (auto result = ReleaseAllBlocks(block_); result.has_error())
+      return result;
+
+    block_ = nullptr;
     return {};
   }
 
@@ -145,36 +306,136 @@ public:
 
   constexpr bool AcceptsReturn() const { return false; }
 
+  const Statistics& GetStatistics() const { return recorder_.GetStatistics(); }
+
 private:
   // Ultimate size of the blocks after accounting for header and alignment.
   [[nodiscard]] static constexpr std::size_t GetAlignedSize() {
     return Provider::GetBlockSize();
   }
 
-  internal::VirtualAddressRange CreateAllocation(std::byte* base) {
-    return internal::VirtualAddressRange{
-        .address = reinterpret_cast<std::uint64_t>(base),
-        .count = GetAlignedSize()};
+  using OccupancyMap = internal::OccupancyMap<GetAlignedSize()>;
+
+  // Bytes reserved past each block header for the occupancy bitmap; zero
+  // when validation is off.
+  [[nodiscard]] static constexpr std::size_t GetValidationReserve() {
+    if constexpr (kValidationEnabled)
+      return internal::AlignUp(sizeof(OccupancyMap),
+                               internal::kMinimumAlignment);
+    else
+      return 0;
+  }
+
+  // The bitmap sits directly past the owning block's header, so a pointer
+  // checks in with one chain walk and one bit test.
+  [[nodiscard]] static OccupancyMap*
+  GetOccupancyMap(internal::BlockHeader* block) {
+    return reinterpret_cast<OccupancyMap*>(internal::AsBytePtr(block) +
+                                           internal::GetBlockHeaderSize());
+  }
+
+  // Largest admissible request: the usable capacity of one provider block.
+  // Anything at or below this bound is guaranteed to fit a freshly grown
+  // block, so a retry after Grow cannot miss.
+  [[nodiscard]] static constexpr std::size_t GetMaxRequestSize() {
+    return GetAlignedSize() - internal::GetBlockHeaderSize() -
+           GetValidationReserve();
+  }
+
+  // The list search shared by the runtime and compile-time Find overloads;
+  // |request_size| is already validated and aligned. When the resident
+  // chain has no fit, one more block is fetched from the provider and the
+  // search retried — a second miss is then genuine exhaustion.
+  Result<std::byte*> FindBySize(std::size_t request_size,
+                                std::size_t alignment) noexcept {
+    if (auto init = InitBlockIfUnset(); init.has_error())
+      return cpp::fail(init.error());
+
+    auto block_or = TakeFit(request_size, alignment);
+    if (block_or.has_error() && block_or.error() == Error::NoFreeBlock) {
+      if (auto grown = Grow(); grown.has_error())
+        return cpp::fail(grown.error());
+
+      block_or = TakeFit(request_size, alignment);
+    }
+
+    return block_or;
+  }
+
+  // The split-and-unlink proper: takes a fitting chunk off the free list
+  // or reports |NoFreeBlock| without touching the provider.
+  Result<std::byte*> TakeFit(std::size_t request_size,
+                             std::size_t alignment) noexcept {
+    if (!free_list_)
+      return cpp::fail(Error::NoFreeBlock);
+
+    internal::Failable<std::optional<internal::HeaderPair>> first_fit_or_error =
+        GetFindBlockFn()(free_list_, request_size);
+    if (first_fit_or_error.has_error())
+      return cpp::fail(Error::Internal);
+
+    std::optional<internal::HeaderPair> first_fit_or =
+        first_fit_or_error.value();
+    if (!first_fit_or.has_value())
+      return cpp::fail(Error::NoFreeBlock);
+
+    auto first_fit = first_fit_or.value();
+    Unlink(first_fit.header);
+
+    auto new_header_or =
+        internal::SplitBlock(first_fit.header, request_size, alignment);
+
+    // TODO: This should never occur. Also, if it is in fact possible,
+    // we should log the error before dropping it on the ground.
+    if (new_header_or.has_error())
+      return cpp::fail(Error::Internal);
+
+    if (auto new_header = new_header_or.value(); new_header) {
+      new_header->next = nullptr;
+      PushFront(new_header);
+      internal::WriteFooter(new_header, /*free=*/true);
+    }
+
+    internal::WriteFooter(first_fit.header, /*free=*/false);
+    recorder_.RecordFind(first_fit.header->size);
+
+    std::byte* payload = internal::GetBlock(first_fit.header);
+    if constexpr (kValidationEnabled) {
+      auto* owner = FindOwningBlock(payload);
+      (void)GetOccupancyMap(owner)->Mark(
+          static_cast<std::size_t>(payload - internal::AsBytePtr(owner)));
+    }
+
+    return payload;
   }
 
   Result<internal::BlockHeader*>
   AllocateNewBlock(internal::BlockHeader* next = nullptr) {
-    Result<std::byte*> base_or = provider_.get().Provide(GetAlignedSize());
+    recorder_.RecordProviderRoundTrip();
+    Result<std::byte*> base_or = provider_.get().Provide(1);
 
     if (base_or.has_error())
       return cpp::fail(base_or.error());
 
     auto allocation = internal::VirtualAddressRange{
         .address = reinterpret_cast<std::uint64_t>(base_or.value()),
-        .count = GetAlignedSize()};
+        .count = GetAlignedSize() / internal::GetPageSize()};
     return internal::BlockHeader::Create(allocation, next);
   }
 
-  Result<void> ReleaseBlock(internal::BlockHeader* block) { return {}; }
+  Result<void> ReleaseBlock(internal::BlockHeader* block) {
+    recorder_.RecordProviderRoundTrip();
+    if (auto result = provider_.get().Return(internal::AsBytePtr(block));
+        result.has_error())
+      return cpp::fail(result.error());
+
+    return {};
+  }
 
   Result<void> ReleaseAllBlocks(internal::BlockHeader* block,
                                 internal::BlockHeader* sentinel = nullptr) {
     auto release = [&](std::byte* p) -> internal::Failable<void> {
+      recorder_.RecordProviderRoundTrip();
       auto result = provider_.get().Return(p);
       if (result.has_error()) {
         DERROR("Block release failed: " << (int)result.error());
@@ -202,26 +463,207 @@ private:
                                                 : internal::FindBlockByWorstFit;
   }
 
+  // Splits |block| down to |target_size| and files the remainder as a free
+  // block, coalesced with a free physical successor so repeated
+  // shrink/grow cycles don't shatter the heap. Unlike
+  // |internal::SplitBlock| this preserves the payload, which a resize must
+  // not destroy. Does nothing when the remainder is too small to stand
+  // alone.
+  void TrimBlock(internal::BlockHeader* block, std::size_t target_size,
+                 std::byte* heap_end) {
+    std::size_t remainder = block->size - target_size;
+    if (remainder < internal::AlignUp(internal::GetBlockHeaderSize() +
+                                          internal::GetBlockFooterSize() + 1,
+                                      internal::kMinimumAlignment))
+      return;
+
+    block->size = target_size;
+    auto* tail = reinterpret_cast<internal::BlockHeader*>(
+        internal::AsBytePtr(block) + target_size);
+    tail->size = remainder;
+    tail->next = nullptr;
+    tail->prev = nullptr;
+
+    if (internal::AsBytePtr(tail) + tail->size < heap_end) {
+      auto* successor = reinterpret_cast<internal::BlockHeader*>(
+          internal::AsBytePtr(tail) + tail->size);
+      auto* footer = internal::GetFooter(successor);
+      if (footer->IsFree() && footer->GetSize() == successor->size) {
+        Unlink(successor);
+        tail->size += successor->size;
+      }
+    }
+
+    PushFront(tail);
+    internal::WriteFooter(tail, /*free=*/true);
+    internal::WriteFooter(block, /*free=*/false);
+  }
+
+  // The free list is doubly-linked so a block discovered through its
+  // neighbor's boundary tag can be unlinked without a walk.
+  void PushFront(internal::BlockHeader* header) {
+    header->prev = nullptr;
+    header->next = free_list_;
+    if (free_list_)
+      free_list_->prev = header;
+
+    free_list_ = header;
+    recorder_.RecordFreeListInsert();
+  }
+
+  void Unlink(internal::BlockHeader* header) {
+    recorder_.RecordFreeListRemove();
+    if (header->prev)
+      header->prev->next = header->next;
+    else
+      free_list_ = header->next;
+
+    if (header->next)
+      header->next->prev = header->prev;
+
+    header->next = nullptr;
+    header->prev = nullptr;
+  }
+
   // TODO: Make this thread safe.
   Result<void> InitBlockIfUnset() {
     if (block_)
       return {};
 
-    auto new_block_or = AllocateNewBlock();
+    return Grow();
+  }
+
+  // Fetches one more block from the provider, prepends it to the chain,
+  // and files its contents as a single free chunk.
+  Result<void> Grow() {
+    auto new_block_or = AllocateNewBlock(block_);
     if (new_block_or.has_error())
       return cpp::fail(new_block_or.error());
 
     block_ = new_block_or.value();
-    free_list_ = internal::PtrAdd(block_, internal::GetBlockHeaderSize());
-    free_list_->next = nullptr;
-    free_list_->size = block_->size - internal::GetBlockHeaderSize();
+    if constexpr (kValidationEnabled)
+      GetOccupancyMap(block_)->Reset();
+
+    auto* chunk = internal::PtrAdd(block_, internal::GetBlockHeaderSize() +
+                                               GetValidationReserve());
+    chunk->size = block_->size - internal::GetBlockHeaderSize() -
+                  GetValidationReserve();
+    PushFront(chunk);
+    internal::WriteFooter(chunk, /*free=*/true);
     return {};
   }
 
+  // Walks the (short) chain of provider blocks for the one containing
+  // |ptr|. Coalescing and bounds are confined to the owning block because
+  // separate provider allocations are not physically contiguous.
+  [[nodiscard]] internal::BlockHeader* FindOwningBlock(std::byte* ptr) const {
+    for (auto* block = block_; block != nullptr; block = block->next) {
+      std::byte* low = internal::AsBytePtr(block);
+      // The upper bound is exclusive: a one-past-the-end pointer belongs
+      // to no allocation, and admitting it would push the occupancy probe
+      // past its bitmap.
+      if (ptr >= low && ptr < low + block->size)
+        return block;
+    }
+
+    return nullptr;
+  }
+
+  // The large-object escape hatch: a request the heap cannot hold maps
+  // directly onto a dedicated run of provider blocks, with a header at
+  // the run's base threaded onto a side list so Return can release
+  // exactly that run. The run never mixes with the heap chain, so heap
+  // coalescing and the free list are untouched by it.
+  Result<std::byte*> FindLarge(Layout layout) {
+    std::size_t payload_offset =
+        internal::AlignUp(internal::GetBlockHeaderSize(), layout.alignment);
+    std::size_t total = payload_offset + layout.size;
+    std::size_t count = (total + GetAlignedSize() - 1) / GetAlignedSize();
+
+    recorder_.RecordProviderRoundTrip();
+    auto base_or = provider_.get().Provide(count);
+    if (base_or.has_error())
+      return cpp::fail(base_or.error());
+
+    auto* header = reinterpret_cast<internal::BlockHeader*>(base_or.value());
+    header->size = count * GetAlignedSize();
+    header->prev = nullptr;
+    header->next = large_list_;
+    if (large_list_)
+      large_list_->prev = header;
+
+    large_list_ = header;
+    recorder_.RecordFind(header->size);
+    return base_or.value() + payload_offset;
+  }
+
+  [[nodiscard]] internal::BlockHeader* FindLargeBlock(std::byte* ptr) const {
+    for (auto* block = large_list_; block != nullptr; block = block->next) {
+      std::byte* low = internal::AsBytePtr(block);
+      if (ptr >= low && ptr < low + block->size)
+        return block;
+    }
+
+    return nullptr;
+  }
+
+  Result<void> ReleaseLargeBlock(internal::BlockHeader* block) {
+    if (block->prev)
+      block->prev->next = block->next;
+    else
+      large_list_ = block->next;
+
+    if (block->next)
+      block->next->prev = block->prev;
+
+    recorder_.RecordReturn(block->size);
+    return ReleaseBlock(block);
+  }
+
+  // A large block holds exactly one allocation, so any interior pointer
+  // resolves to it; growth within the run's trailing slack is free, and
+  // anything else moves the payload through Find/Return.
+  Result<std::byte*> ResizeLarge(std::byte* ptr, std::size_t new_size) {
+    auto* large = FindLargeBlock(ptr);
+    if (large == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t capacity = static_cast<std::size_t>(
+        internal::AsBytePtr(large) + large->size - ptr);
+    if (new_size <= capacity)
+      return ptr;
+
+    auto moved_or = Find(new_size);
+    if (moved_or.has_error())
+      return cpp::fail(moved_or.error());
+
+    std::memcpy(moved_or.value(), ptr, capacity);
+    (void)Return(ptr);
+    return moved_or;
+  }
+
+  void UnlinkBlock(internal::BlockHeader* block) {
+    if (block_ == block) {
+      block_ = block->next;
+      return;
+    }
+
+    for (auto* itr = block_; itr != nullptr; itr = itr->next) {
+      if (itr->next == block) {
+        itr->next = block->next;
+        return;
+      }
+    }
+  }
+
   std::reference_wrapper<Provider> provider_;
 
   internal::BlockHeader* block_ = nullptr;
   internal::BlockHeader* free_list_ = nullptr;
+  internal::BlockHeader* large_list_ = nullptr;
+
+  [[no_unique_address]] internal::StatsRecorderFor<kStatisticsEnabled>
+      recorder_;
 };
 
 } // namespace allocators::strategy
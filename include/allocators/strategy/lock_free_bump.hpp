@@ -1,12 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
 #include <functional>
+#include <mutex>
+#include <span>
 
 #include <template/parameters.hpp>
 
 #include <allocators/common/error.hpp>
+#include <allocators/common/stats.hpp>
 #include <allocators/common/trait.hpp>
+#include <allocators/internal/block.hpp>
+#include <allocators/internal/platform.hpp>
 #include <allocators/internal/util.hpp>
 
 namespace allocators::strategy {
@@ -31,14 +39,30 @@ namespace allocators::strategy {
 // This provider is thread-safe using lock-free algorithms.
 template <class Provider, class... Args>
 requires ProviderTrait<Provider>
-class LockFreeBump {
+class LockFreeBump : public StatsParams {
 public:
+  static constexpr bool kStatisticsEnabled =
+      ntp::optional<StatisticsT<false>, Args...>::value;
+
   explicit LockFreeBump(Provider& provider) : provider_(provider) {}
 
   ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(LockFreeBump);
 
   // TODO: Don't ignore this error.
-  ~LockFreeBump() { (void)Reset(); }
+  ~LockFreeBump() {
+    (void)Reset();
+
+    for (auto& slot : directory_) {
+      std::byte** leaf = slot.load();
+      if (!leaf)
+        continue;
+
+      (void)internal::ReturnPages(internal::VirtualAddressRange{
+          .address = reinterpret_cast<std::uint64_t>(leaf),
+          .count = kLeafSizeInPages});
+      slot.store(nullptr);
+    }
+  }
 
   Result<std::byte*> Find(Layout layout) noexcept {
     if (!IsValid(layout))
@@ -46,13 +70,50 @@ public:
 
     std::size_t request_size = internal::AlignUp(layout.size, layout.alignment);
 
+    if (request_size > provider_.get().GetBlockSize())
+      return FindLarge(layout);
+
+    return FindBySize(request_size);
+  }
+
+  Result<std::byte*> Find(std::size_t size) noexcept {
+    return Find(Layout(size, internal::kMinimumAlignment));
+  }
+
+  // Compile-time-layout overload for call sites allocating a type whose
+  // size and alignment are constants — the overwhelmingly common case.
+  // Validation, the align-up, and the block-size bound all resolve at
+  // compile time (an oversized request dispatches straight to the
+  // large-object path), collapsing the hot path to the bare bump CAS.
+  template <std::size_t Size,
+            std::size_t Alignment = internal::kMinimumAlignment>
+  Result<std::byte*> Find() noexcept {
+    static_assert(Size > 0, "Size must be nonzero.");
+    static_assert(internal::IsValidAlignment(Alignment),
+                  "Alignment must be a power of 2 no smaller than "
+                  "kMinimumAlignment.");
+
+    constexpr std::size_t kRequestSize = internal::AlignUp(Size, Alignment);
+    if constexpr (kRequestSize > Provider::GetBlockSize())
+      return FindLarge(Layout(Size, Alignment));
+    else
+      return FindBySize(kRequestSize);
+  }
+
+  // Bulk allocation. One CAS against |active_| reserves space for as many
+  // batch entries as fit in the current block, so a 100-object batch
+  // typically costs one atomic operation rather than 100.
+  Result<void> FindMany(Layout layout, std::span<std::byte*> out) noexcept {
+    if (!IsValid(layout) || out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t request_size = internal::AlignUp(layout.size, layout.alignment);
+
     if (request_size > provider_.get().GetBlockSize())
       return cpp::fail(Error::SizeRequestTooLarge);
 
-    // The loop here is a little deceiving. The intention here is not to
-    // loop endlessly. Instead, the loop aids the subsequent atomic operations.
-    // In practice, no more than one iteration will be needed.
-    while (true) {
+    std::size_t filled = 0;
+    while (filled < out.size()) {
       BlockDescriptor old_active = active_.load();
       if (!old_active.initialized) {
         if (auto result = AllocateNewBlock(); result.has_error())
@@ -61,8 +122,10 @@ public:
         continue;
       }
 
-      std::size_t headroom = provider_.get().GetBlockSize() - old_active.size;
-      if (headroom < request_size) {
+      std::size_t headroom = provider_.get().GetBlockSize() - old_active.offset;
+      std::size_t chunk =
+          std::min(headroom / request_size, out.size() - filled);
+      if (chunk == 0) {
         if (auto result = AllocateNewBlock(); result.has_error())
           return cpp::fail(result.error());
 
@@ -70,32 +133,111 @@ public:
       }
 
       BlockDescriptor new_active = old_active;
-      new_active.offset = old_active.offset + request_size;
-      if (active_.compare_exchange_weak(old_active, new_active))
-        return block_table_[old_active.index] + old_active.offset;
+      new_active.offset = old_active.offset + chunk * request_size;
+      if (!active_.compare_exchange_weak(old_active, new_active)) {
+        recorder_.RecordCasRetry();
+        continue;
+      }
+
+      std::byte* base = GetBlockAt(old_active.index) + old_active.offset;
+      for (std::size_t i = 0; i < chunk; ++i)
+        out[filled + i] = base + i * request_size;
+
+      recorder_.RecordFind(chunk * request_size);
+      filled += chunk;
     }
-  }
 
-  Result<std::byte*> Find(std::size_t size) noexcept {
-    return Find(Layout(size, internal::kMinimumAlignment));
+    return {};
   }
 
   Result<void> Return(std::byte* ptr) {
-    // The bump allocator does not support per-object deallocation.
+    // Bump allocations carry no per-object metadata and are reclaimed by
+    // Rewind/Reset; only large passthrough blocks, which do, can be
+    // returned individually.
+    std::scoped_lock lock(large_mutex_);
+    if (auto* block = FindLargeBlock(ptr))
+      return ReleaseLargeBlock(block);
+
     return cpp::fail(Error::OperationNotSupported);
   }
 
+  Result<std::byte*> Resize(std::byte* ptr, std::size_t new_size) {
+    // Bump allocations carry no per-object metadata, so neither the extent
+    // of |ptr| nor its physical successor can be recovered; resizing is not
+    // supported.
+    return cpp::fail(Error::OperationNotSupported);
+  }
+
+  // Opaque position in the arena captured by |Checkpoint|. Only meaningful
+  // when passed back to the instance that produced it.
+  struct Marker {
+    std::uint64_t position = 0;
+  };
+
+  // Captures the current bump position so a later |Rewind| can drop every
+  // allocation made in between.
+  Marker Checkpoint() const {
+    return Marker{std::bit_cast<std::uint64_t>(active_.load())};
+  }
+
+  // Rewinds the bump position to |marker| in O(1). Unlike |Reset|, blocks
+  // allocated since the marker are kept and reused by subsequent
+  // allocations, so nested phase lifetimes recycle hot, already-mapped
+  // memory instead of round-tripping through the provider. Every pointer
+  // handed out after the marker was taken becomes invalid.
+  //
+  // The caller must guarantee no other thread allocates concurrently or
+  // still holds allocations made after the marker; the intended use is a
+  // per-request scope on an arena owned by one handler at a time.
+  Result<void> Rewind(Marker marker) {
+    auto target = std::bit_cast<BlockDescriptor>(marker.position);
+    auto current = active_.load();
+
+    // A marker can only move the position backwards.
+    if (target.initialized &&
+        (!current.initialized || target.index > current.index ||
+         (target.index == current.index && target.offset > current.offset)))
+      return cpp::fail(Error::InvalidInput);
+
+    // A marker taken before the first block existed rewinds to the start
+    // of block zero; the block itself stays mapped for reuse.
+    if (!target.initialized && current.initialized) {
+      target.initialized = 1;
+      target.index = 0;
+      target.offset = 0;
+    }
+
+    active_.store(target);
+    return {};
+  }
+
   Result<void> Reset() {
+    {
+      std::scoped_lock lock(large_mutex_);
+      while (large_list_) {
+        if (auto result = ReleaseLargeBlock(large_list_); result.has_error())
+          return result;
+      }
+    }
+
     auto old_active = active_.load();
     if (!old_active.initialized)
       return {};
 
-    for (auto i = 0u; i <= old_active.index; i++) {
-      if (auto result = provider_.get().Return(block_table_[i]);
-          result.has_error())
+    // Rewinding can leave live blocks past the active index, so walk the
+    // table until the first empty slot rather than stopping at the index.
+    for (std::size_t i = 0; i < (1ul << kTotalEntryInBits); i++) {
+      if (!directory_[i >> kLeafBits].load())
+        break;
+
+      std::byte* block = GetBlockAt(i);
+      if (!block)
+        break;
+
+      if (auto result = provider_.get().Return(block); result.has_error())
         return cpp::fail(result.error());
 
-      block_table_[i] = nullptr;
+      SetBlockAt(i, nullptr);
     }
 
     active_.store(BlockDescriptor());
@@ -107,14 +249,26 @@ public:
 
   constexpr bool AcceptsReturn() const { return false; }
 
+  const Statistics& GetStatistics() const { return recorder_.GetStatistics(); }
+
 private:
-  // This only allows ~1,000 descriptors which isn't a lot. Initially, this was
-  // set to 20 bits, but that blew the static data space, causing immediate
-  // segfaults.
-  // TODO: Figure out a way to improve block_table_ size without ballooning
-  //  virtual address space. Perhaps, we can model something like the page table
-  //  structures where multiple tables are used to determine the final address.
-  static constexpr unsigned kTotalEntryInBits = 10;
+  // The block table is structured like a two-level page table: a small
+  // static directory of pointers to lazily-mapped leaf tables. A flat static
+  // array at 20 bits blew the static data space, causing immediate
+  // segfaults; with the directory only 8KB lives in static data and each
+  // leaf is mapped on first use, so capacity scales to ~1M blocks without
+  // ballooning the binary or virtual address space.
+  static constexpr unsigned kDirectoryBits = 10;
+  static constexpr unsigned kLeafBits = 10;
+  static constexpr unsigned kTotalEntryInBits = kDirectoryBits + kLeafBits;
+
+  static constexpr std::size_t kLeafEntryCount = 1ul << kLeafBits;
+
+  // Size of one leaf table in pages, rounded up to whole pages.
+  static constexpr std::size_t kLeafSizeInPages =
+      internal::AlignUp(kLeafEntryCount * sizeof(std::byte*),
+                        internal::GetPageSize()) /
+      internal::GetPageSize();
 
   struct BlockDescriptor {
     // Whether the block was status.
@@ -135,22 +289,75 @@ private:
     std::uint64_t _unused : 2;
   };
 
+  // The bump path proper, shared by the runtime and compile-time Find
+  // overloads; |request_size| is already validated and aligned.
+  Result<std::byte*> FindBySize(std::size_t request_size) noexcept {
+    // The loop here is a little deceiving. The intention here is not to
+    // loop endlessly. Instead, the loop aids the subsequent atomic operations.
+    // In practice, no more than one iteration will be needed.
+    while (true) {
+      BlockDescriptor old_active = active_.load();
+      if (!old_active.initialized) {
+        if (auto result = AllocateNewBlock(); result.has_error())
+          return cpp::fail(result.error());
+
+        continue;
+      }
+
+      std::size_t headroom = provider_.get().GetBlockSize() - old_active.offset;
+      if (headroom < request_size) {
+        if (auto result = AllocateNewBlock(); result.has_error())
+          return cpp::fail(result.error());
+
+        continue;
+      }
+
+      BlockDescriptor new_active = old_active;
+      new_active.offset = old_active.offset + request_size;
+      if (active_.compare_exchange_weak(old_active, new_active)) {
+        recorder_.RecordFind(request_size);
+        return GetBlockAt(old_active.index) + old_active.offset;
+      }
+
+      recorder_.RecordCasRetry();
+    }
+  }
+
   Result<void> AllocateNewBlock() {
     auto old_active = active_.load();
     auto new_active = old_active;
     new_active.offset = 0;
-    if (old_active.initialized)
+    if (old_active.initialized) {
+      if (old_active.index + 1 >= (1ul << kTotalEntryInBits))
+        return cpp::fail(Error::ReachedMemoryLimit);
+
       new_active.index = old_active.index + 1;
+    }
     // We always set this to help with the init case where |active_| is
     // 0.
     new_active.initialized = 1;
 
+    // Map the leaf before publishing the new index so the table write after
+    // the CAS (and any reader that observes the index) can't miss it.
+    if (auto result = GetOrMapLeaf(new_active.index); result.has_error())
+      return cpp::fail(result.error());
+
+    // A rewind leaves its blocks in the table for exactly this moment:
+    // advancing onto an already-mapped block skips the provider entirely.
+    if (GetBlockAt(new_active.index) != nullptr) {
+      if (!active_.compare_exchange_weak(old_active, new_active))
+        recorder_.RecordCasRetry();
+
+      return {};
+    }
+
+    recorder_.RecordProviderRoundTrip();
     auto new_block_or = provider_.get().Provide(1);
     if (new_block_or.has_error())
       return cpp::fail(Error::OutOfMemory);
 
     if (active_.compare_exchange_weak(old_active, new_active)) {
-      block_table_[new_active.index] = new_block_or.value();
+      SetBlockAt(new_active.index, new_block_or.value());
     } else if (auto result = provider_.get().Return(new_block_or.value());
                result.has_error()) {
       return cpp::fail(result.error());
@@ -159,14 +366,115 @@ private:
     return {};
   }
 
+  // Returns the leaf table covering |index|, mapping it on first use. Losing
+  // the install race simply unmaps the redundant leaf and uses the winner's.
+  Result<std::byte**> GetOrMapLeaf(std::size_t index) {
+    auto& slot = directory_[index >> kLeafBits];
+    std::byte** leaf = slot.load();
+    if (leaf)
+      return leaf;
+
+    auto va_range_or = internal::FetchPages(kLeafSizeInPages);
+    if (va_range_or.has_error())
+      return cpp::fail(Error::OutOfMemory);
+
+    auto* fresh = reinterpret_cast<std::byte**>(va_range_or.value().address);
+    std::byte** expected = nullptr;
+    if (slot.compare_exchange_strong(expected, fresh))
+      return fresh;
+
+    (void)internal::ReturnPages(va_range_or.value());
+    return expected;
+  }
+
+  // The large-object escape hatch: a request exceeding the block size
+  // maps directly onto a dedicated run of provider blocks, with a header
+  // at the run's base threaded onto a mutex-guarded side list so Return
+  // and Reset release exactly that run. The lock never touches the bump
+  // hot path, and a large allocation is provider-weight to begin with.
+  Result<std::byte*> FindLarge(Layout layout) {
+    std::size_t payload_offset =
+        internal::AlignUp(internal::GetBlockHeaderSize(), layout.alignment);
+    std::size_t total = payload_offset + layout.size;
+    std::size_t block_size = provider_.get().GetBlockSize();
+    std::size_t count = (total + block_size - 1) / block_size;
+
+    recorder_.RecordProviderRoundTrip();
+    auto base_or = provider_.get().Provide(count);
+    if (base_or.has_error())
+      return cpp::fail(base_or.error());
+
+    auto* header = reinterpret_cast<internal::BlockHeader*>(base_or.value());
+    header->size = count * block_size;
+    header->prev = nullptr;
+
+    {
+      std::scoped_lock lock(large_mutex_);
+      header->next = large_list_;
+      if (large_list_)
+        large_list_->prev = header;
+
+      large_list_ = header;
+    }
+
+    recorder_.RecordFind(header->size);
+    return base_or.value() + payload_offset;
+  }
+
+  // Both helpers below expect |large_mutex_| to be held.
+  [[nodiscard]] internal::BlockHeader* FindLargeBlock(std::byte* ptr) const {
+    for (auto* block = large_list_; block != nullptr; block = block->next) {
+      std::byte* low = internal::AsBytePtr(block);
+      if (ptr >= low && ptr < low + block->size)
+        return block;
+    }
+
+    return nullptr;
+  }
+
+  Result<void> ReleaseLargeBlock(internal::BlockHeader* block) {
+    if (block->prev)
+      block->prev->next = block->next;
+    else
+      large_list_ = block->next;
+
+    if (block->next)
+      block->next->prev = block->prev;
+
+    recorder_.RecordReturn(block->size);
+    recorder_.RecordProviderRoundTrip();
+    if (auto result = provider_.get().Return(internal::AsBytePtr(block));
+        result.has_error())
+      return cpp::fail(result.error());
+
+    return {};
+  }
+
+  std::byte* GetBlockAt(std::size_t index) {
+    return directory_[index >> kLeafBits].load()[index & (kLeafEntryCount - 1)];
+  }
+
+  void SetBlockAt(std::size_t index, std::byte* block) {
+    directory_[index >> kLeafBits].load()[index & (kLeafEntryCount - 1)] =
+        block;
+  }
+
   // Backing allocator to used to acquire and release blocks.
   std::reference_wrapper<Provider> provider_;
 
   // Tracking anchor for currently active_ block.
   std::atomic<BlockDescriptor> active_ = BlockDescriptor();
 
-  // Table of all allocated blocks.
-  std::array<std::byte*, 1 << kTotalEntryInBits> block_table_ = {0};
+  // Directory of lazily-mapped leaf tables holding all allocated blocks.
+  std::array<std::atomic<std::byte**>, 1 << kDirectoryBits> directory_ = {};
+
+  // Side list of large passthrough blocks; touched only on the (rare,
+  // provider-weight) large path, never by the bump CAS.
+  internal::BlockHeader* large_list_ = nullptr;
+  std::mutex large_mutex_;
+
+  [[no_unique_address]] internal::StatsRecorderFor<kStatisticsEnabled>
+      recorder_;
 };
 
 } // namespace allocators::strategy
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+
+#include <template/optional.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/common/stats.hpp>
+#include <allocators/common/trait.hpp>
+#include <allocators/internal/block.hpp>
+#include <allocators/internal/util.hpp>
+
+namespace allocators::strategy {
+
+struct PoolParams : StatsParams {
+  // Size of the objects carved out of each provider block. Every slot is
+  // exactly this many bytes (rounded up to the slot alignment); requests
+  // larger than it are rejected.
+  template <std::size_t Size>
+  struct ObjectSizeT : std::integral_constant<std::size_t, Size> {};
+
+  // Alignment of every slot. The constraints for this value are that it is
+  // a power of two and greater than |sizeof(void*)|.
+  template <std::size_t Alignment>
+  struct AlignmentT : std::integral_constant<std::size_t, Alignment> {};
+};
+
+// Fixed-size pool strategy for workloads that allocate many identical
+// objects. Each provider block is carved into slots of |ObjectSizeT| bytes
+// up front, and free slots are threaded into an intrusive stack through
+// their own storage — no per-object headers, no search. Find pops the
+// stack and Return pushes it, both in constant time; when the stack runs
+// dry a fresh provider block is fetched and carved.
+//
+// Because slots carry no metadata, Find accepts any request that fits
+// within one slot but always hands out a full slot.
+template <class Provider, class... Args>
+requires ProviderTrait<Provider>
+class Pool : public PoolParams {
+public:
+  static constexpr std::size_t kDefaultObjectSize = 64;
+
+  static constexpr std::size_t kAlignment =
+      std::max({sizeof(void*), ntp::optional<AlignmentT<0>, Args...>::value});
+
+  static constexpr std::size_t kObjectSize = std::max(
+      {sizeof(void*), ntp::optional<ObjectSizeT<kDefaultObjectSize>, Args...>::value});
+
+  // A free slot stores the link to the next free slot in its own first
+  // word, so every slot must hold at least a pointer.
+  static constexpr std::size_t kSlotSize =
+      internal::AlignUp(kObjectSize, kAlignment);
+
+  static constexpr bool kStatisticsEnabled =
+      ntp::optional<StatisticsT<false>, Args...>::value;
+
+  Pool(Provider& provider) : provider_(provider) {}
+
+  ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(Pool);
+
+  Result<std::byte*> Find(Layout layout) noexcept {
+    if (!IsValid(layout))
+      return cpp::fail(Error::InvalidInput);
+
+    if (layout.size > kObjectSize || layout.alignment > kAlignment)
+      return cpp::fail(Error::SizeRequestTooLarge);
+
+    if (free_stack_ == nullptr)
+      if (auto result = AllocateNewBlock(); result.has_error())
+        return cpp::fail(result.error());
+
+    Slot* slot = free_stack_;
+    free_stack_ = slot->next;
+    recorder_.RecordFreeListRemove();
+    recorder_.RecordFind(kSlotSize);
+    return reinterpret_cast<std::byte*>(slot);
+  }
+
+  Result<std::byte*> Find(std::size_t size) noexcept {
+    return Find(Layout(size, internal::kMinimumAlignment));
+  }
+
+  // Bulk allocation: pops one slot per batch entry. Each pop is already a
+  // pointer swap, so there is nothing to amortize; on failure the slots
+  // handed out so far are pushed back before the error surfaces.
+  Result<void> FindMany(Layout layout, std::span<std::byte*> out) noexcept {
+    if (out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      auto slot_or = Find(layout);
+      if (slot_or.has_error()) {
+        while (i > 0)
+          (void)Return(out[--i]);
+
+        return cpp::fail(slot_or.error());
+      }
+
+      out[i] = slot_or.value();
+    }
+
+    return {};
+  }
+
+  // Every slot is the same size, so a resize never moves: any request that
+  // fits the slot keeps its pointer, and anything larger is rejected just
+  // as Find would reject it.
+  Result<std::byte*> Resize(std::byte* ptr, std::size_t new_size) {
+    if (ptr == nullptr || new_size == 0 || !Owns(ptr))
+      return cpp::fail(Error::InvalidInput);
+
+    if (new_size > kObjectSize)
+      return cpp::fail(Error::SizeRequestTooLarge);
+
+    return ptr;
+  }
+
+  Result<void> Return(std::byte* ptr) {
+    if (ptr == nullptr || !Owns(ptr))
+      return cpp::fail(Error::InvalidInput);
+
+    auto* slot = reinterpret_cast<Slot*>(ptr);
+    slot->next = free_stack_;
+    free_stack_ = slot;
+    recorder_.RecordFreeListInsert();
+    recorder_.RecordReturn(kSlotSize);
+    return {};
+  }
+
+  Result<void> Reset() {
+    if (!block_)
+      return {};
+
+    if (auto result = ReleaseAllBlocks(block_); result.has_error())
+      return result;
+
+    block_ = nullptr;
+    free_stack_ = nullptr;
+    return {};
+  }
+
+  constexpr bool AcceptsAlignment() const { return true; }
+
+  constexpr bool AcceptsReturn() const { return false; }
+
+  const Statistics& GetStatistics() const { return recorder_.GetStatistics(); }
+
+private:
+  struct Slot {
+    Slot* next;
+  };
+
+  // Slot storage begins past the block header, aligned up so every slot
+  // honors |kAlignment|.
+  [[nodiscard]] static std::byte*
+  GetSlotBase(internal::BlockHeader* block) {
+    auto base = reinterpret_cast<std::uintptr_t>(
+        internal::AsBytePtr(block) + internal::GetBlockHeaderSize());
+    return reinterpret_cast<std::byte*>(internal::AlignUp(base, kAlignment));
+  }
+
+  [[nodiscard]] static std::size_t
+  GetSlotCount(internal::BlockHeader* block) {
+    std::byte* base = GetSlotBase(block);
+    std::byte* end = internal::AsBytePtr(block) + block->size;
+    return static_cast<std::size_t>(end - base) / kSlotSize;
+  }
+
+  // Ownership check walks the (short) chain of provider blocks and
+  // verifies the pointer lands exactly on a slot boundary.
+  [[nodiscard]] bool Owns(std::byte* ptr) const {
+    for (auto* block = block_; block != nullptr; block = block->next) {
+      std::byte* base = GetSlotBase(block);
+      std::byte* end = internal::AsBytePtr(block) + block->size;
+      if (ptr < base || ptr >= end)
+        continue;
+
+      return static_cast<std::size_t>(ptr - base) % kSlotSize == 0;
+    }
+
+    return false;
+  }
+
+  Result<void> AllocateNewBlock() {
+    recorder_.RecordProviderRoundTrip();
+    Result<std::byte*> base_or = provider_.get().Provide(1);
+    if (base_or.has_error())
+      return cpp::fail(base_or.error());
+
+    auto allocation = internal::VirtualAddressRange{
+        .address = reinterpret_cast<std::uint64_t>(base_or.value()),
+        .count = GetAlignedSize() / internal::GetPageSize()};
+    block_ = internal::BlockHeader::Create(allocation, block_);
+
+    // Carve the block into slots and thread them all onto the free stack.
+    // Pushing in reverse address order means allocations walk the block
+    // front to back.
+    std::byte* base = GetSlotBase(block_);
+    for (std::size_t i = GetSlotCount(block_); i > 0; --i) {
+      auto* slot = reinterpret_cast<Slot*>(base + (i - 1) * kSlotSize);
+      slot->next = free_stack_;
+      free_stack_ = slot;
+      recorder_.RecordFreeListInsert();
+    }
+
+    return {};
+  }
+
+  Result<void> ReleaseAllBlocks(internal::BlockHeader* block) {
+    auto release = [&](std::byte* p) -> internal::Failable<void> {
+      recorder_.RecordProviderRoundTrip();
+      auto result = provider_.get().Return(p);
+      if (result.has_error()) {
+        DERROR("Block release failed: " << (int)result.error());
+        return cpp::fail(internal::Failure::ReleaseFailed);
+      }
+
+      return {};
+    };
+    if (auto result = internal::ReleaseBlockList(block, std::move(release));
+        result.has_error())
+      return cpp::fail(Error::Internal);
+
+    return {};
+  }
+
+  // Ultimate size of the blocks after accounting for header and alignment.
+  [[nodiscard]] static constexpr std::size_t GetAlignedSize() {
+    return Provider::GetBlockSize();
+  }
+
+  // Various assertions hidden from user API but added here to ensure
+  // invariants are met at compile time.
+  static_assert(internal::IsPowerOfTwo(kAlignment),
+                "kAlignment must be a power of 2.");
+  static_assert(kSlotSize <= Provider::GetBlockSize() -
+                                 internal::GetBlockHeaderSize(),
+                "kObjectSize must fit within a provider block.");
+
+  std::reference_wrapper<Provider> provider_;
+
+  internal::BlockHeader* block_ = nullptr;
+  Slot* free_stack_ = nullptr;
+
+  [[no_unique_address]] internal::StatsRecorderFor<kStatisticsEnabled>
+      recorder_;
+};
+
+} // namespace allocators::strategy
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+
+#include <template/parameters.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/common/stats.hpp>
+#include <allocators/common/trait.hpp>
+#include <allocators/internal/block.hpp>
+#include <allocators/internal/util.hpp>
+
+namespace allocators::strategy {
+
+// Bump allocator with cross-thread free support for pipeline workloads: one
+// owning thread allocates (the producer), any thread frees (the consumers).
+// |LockFreeBump| rejects per-object frees outright, which rules out the
+// classic pattern where a producer carves messages out of its arena and a
+// consumer on another thread releases them as it finishes each one.
+//
+// Each provider block carries a small anchor at its base holding an
+// intrusive MPSC stack: a remote free is one CAS push onto the freed slot's
+// own block, touching no allocator-wide shared state. The owning thread
+// drains the stacks opportunistically during Find — freed slots are counted,
+// not reused, since a bump layout records no per-object sizes — and a
+// retired block whose drained count reaches its allocation count goes back
+// to the provider whole. The owner's bump path itself stays free of atomics
+// entirely; only the remote stacks are shared.
+//
+// Find and Reset must only be called from the owning thread; Return is safe
+// from any thread. A block is released only after every one of its objects
+// has been freed, so no consumer can push onto a stack that is going away.
+// The provider's blocks must be naturally aligned to their own size (true of
+// the page providers), which is what lets Return recover the owning block
+// from a bare pointer with one mask.
+template <class Provider, class... Args>
+requires ProviderTrait<Provider>
+class RemoteFreeBump : public StatsParams {
+public:
+  static constexpr bool kStatisticsEnabled =
+      ntp::optional<StatisticsT<false>, Args...>::value;
+
+  explicit RemoteFreeBump(Provider& provider) : provider_(provider) {}
+
+  ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(RemoteFreeBump);
+
+  // TODO: Don't ignore this error.
+  ~RemoteFreeBump() { (void)Reset(); }
+
+  Result<std::byte*> Find(Layout layout) noexcept {
+    if (!IsValid(layout))
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t request_size = internal::AlignUp(layout.size, layout.alignment);
+
+    if (request_size > GetCapacity())
+      return cpp::fail(Error::SizeRequestTooLarge);
+
+    // Opportunistic bookkeeping: count what the consumers freed since the
+    // last call and release any retired block that is now fully dead.
+    DrainRemoteFrees();
+
+    if (active_ == nullptr)
+      if (auto result = AllocateNewBlock(); result.has_error())
+        return cpp::fail(result.error());
+
+    if (Provider::GetBlockSize() - offset_ < request_size) {
+      RetireActiveBlock();
+      if (auto result = AllocateNewBlock(); result.has_error())
+        return cpp::fail(result.error());
+    }
+
+    std::byte* out = internal::AsBytePtr(active_) + offset_;
+    offset_ += request_size;
+    ++active_->allocated;
+    active_->bumped += request_size;
+    recorder_.RecordFind(request_size);
+    return out;
+  }
+
+  Result<std::byte*> Find(std::size_t size) noexcept {
+    return Find(Layout(size, internal::kMinimumAlignment));
+  }
+
+  // Bulk allocation. The owner's path has no synchronization to amortize,
+  // so this is a convenience loop; on failure every slot handed out so far
+  // is pushed back through Return before the error surfaces.
+  Result<void> FindMany(Layout layout, std::span<std::byte*> out) noexcept {
+    if (out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      auto block_or = Find(layout);
+      if (block_or.has_error()) {
+        while (i > 0)
+          (void)Return(out[--i]);
+
+        return cpp::fail(block_or.error());
+      }
+
+      out[i] = block_or.value();
+    }
+
+    return {};
+  }
+
+  Result<std::byte*> Resize(std::byte* ptr, std::size_t new_size) {
+    // Bump allocations carry no per-object metadata, so neither the extent
+    // of |ptr| nor its physical successor can be recovered; resizing is not
+    // supported.
+    return cpp::fail(Error::OperationNotSupported);
+  }
+
+  // Frees |ptr| from any thread by pushing it onto its block's MPSC stack.
+  // The slot's own first word stores the link — every allocation is at
+  // least pointer-sized and the contents are dead at this point — so the
+  // push costs one CAS on the block's anchor and nothing allocator-wide.
+  Result<void> Return(std::byte* ptr) {
+    if (ptr == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    BlockAnchor* anchor = GetAnchor(ptr);
+    std::byte* head = anchor->remote_head.load(std::memory_order_relaxed);
+    do {
+      *reinterpret_cast<std::byte**>(ptr) = head;
+    } while (!anchor->remote_head.compare_exchange_weak(
+        head, ptr, std::memory_order_release, std::memory_order_relaxed));
+
+    // Count the free only; the bytes come off the gauge when the block is
+    // reclaimed whole (see |DrainRemoteFrees|), which is where they are
+    // known.
+    recorder_.RecordReturn(0);
+    return {};
+  }
+
+  Result<void> Reset() {
+    RetireActiveBlock();
+
+    while (retired_) {
+      BlockAnchor* anchor = retired_;
+      retired_ = anchor->next;
+      recorder_.RecordReclaim(anchor->bumped);
+      recorder_.RecordProviderRoundTrip();
+      if (auto result = provider_.get().Return(internal::AsBytePtr(anchor));
+          result.has_error())
+        return cpp::fail(result.error());
+    }
+
+    offset_ = 0;
+    return {};
+  }
+
+  constexpr bool AcceptsAlignment() const { return true; }
+
+  constexpr bool AcceptsReturn() const { return true; }
+
+  const Statistics& GetStatistics() const { return recorder_.GetStatistics(); }
+
+private:
+  // Lives at the base of every provider block, ahead of the bump region.
+  struct BlockAnchor {
+    // Head of the MPSC stack of remote-freed slots. The only field shared
+    // with consumer threads.
+    std::atomic<std::byte*> remote_head;
+
+    // Objects handed out of this block. Owner-only.
+    std::size_t allocated;
+
+    // Payload bytes handed out of this block; reclaimed for the
+    // statistics gauge when the block is released whole. Owner-only.
+    std::size_t bumped;
+
+    // Remote frees drained from the stack so far. Owner-only.
+    std::size_t drained;
+
+    // Next block on the owner's retired list. Owner-only.
+    BlockAnchor* next;
+  };
+
+  static constexpr std::size_t kHeaderSize =
+      internal::AlignUp(sizeof(BlockAnchor), internal::kMinimumAlignment);
+
+  // Largest single request: one block minus its anchor.
+  [[nodiscard]] static constexpr std::size_t GetCapacity() {
+    return Provider::GetBlockSize() - kHeaderSize;
+  }
+
+  // Blocks are naturally aligned to their size, so the owning anchor of any
+  // interior pointer is one mask away.
+  [[nodiscard]] static BlockAnchor* GetAnchor(std::byte* ptr) {
+    return reinterpret_cast<BlockAnchor*>(
+        reinterpret_cast<std::uintptr_t>(ptr) &
+        ~(Provider::GetBlockSize() - 1));
+  }
+
+  Result<void> AllocateNewBlock() {
+    recorder_.RecordProviderRoundTrip();
+    auto block_or = provider_.get().Provide(1);
+    if (block_or.has_error())
+      return cpp::fail(Error::OutOfMemory);
+
+    auto* anchor = reinterpret_cast<BlockAnchor*>(block_or.value());
+    anchor->remote_head.store(nullptr, std::memory_order_relaxed);
+    anchor->allocated = 0;
+    anchor->bumped = 0;
+    anchor->drained = 0;
+    anchor->next = nullptr;
+
+    active_ = anchor;
+    offset_ = kHeaderSize;
+    return {};
+  }
+
+  void RetireActiveBlock() {
+    if (active_ == nullptr)
+      return;
+
+    active_->next = retired_;
+    retired_ = active_;
+    active_ = nullptr;
+  }
+
+  // Pops the whole stack with one exchange and counts the slots. The
+  // acquire pairs with the release in Return so the drained count can be
+  // trusted as "these objects are dead".
+  static void DrainBlock(BlockAnchor* anchor) {
+    std::byte* head =
+        anchor->remote_head.exchange(nullptr, std::memory_order_acquire);
+    while (head) {
+      head = *reinterpret_cast<std::byte**>(head);
+      ++anchor->drained;
+    }
+  }
+
+  void DrainRemoteFrees() {
+    if (active_)
+      DrainBlock(active_);
+
+    BlockAnchor** link = &retired_;
+    while (*link) {
+      BlockAnchor* anchor = *link;
+      DrainBlock(anchor);
+
+      // Every object freed and no longer the active block: nobody can hold
+      // a pointer into it, so no further push can arrive. Safe to release.
+      if (anchor->drained == anchor->allocated) {
+        *link = anchor->next;
+        // The bytes come off the gauge here, where they are known: Return
+        // only counts the free, since a bump layout records no per-object
+        // sizes until the whole block dies.
+        recorder_.RecordReclaim(anchor->bumped);
+        recorder_.RecordProviderRoundTrip();
+        (void)provider_.get().Return(internal::AsBytePtr(anchor));
+        continue;
+      }
+
+      link = &anchor->next;
+    }
+  }
+
+  // Backing allocator used to acquire and release blocks.
+  std::reference_wrapper<Provider> provider_;
+
+  // Block currently being bumped into. Owner-only.
+  BlockAnchor* active_ = nullptr;
+
+  // Offset of the next allocation within |active_|. Owner-only.
+  std::size_t offset_ = 0;
+
+  // Retired blocks waiting for their last remote frees. Owner-only.
+  BlockAnchor* retired_ = nullptr;
+
+  [[no_unique_address]] internal::StatsRecorderFor<kStatisticsEnabled>
+      recorder_;
+};
+
+} // namespace allocators::strategy
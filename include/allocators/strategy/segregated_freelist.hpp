@@ -0,0 +1,284 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <span>
+
+#include <template/optional.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/common/trait.hpp>
+#include <allocators/internal/block.hpp>
+#include <allocators/internal/util.hpp>
+
+namespace allocators::strategy {
+
+struct SegregatedFreeListParams {
+  // Alignment used when making an allocation. Usually, allocators defer to the
+  // alignment of the underlying object they are allocating. The constrains for
+  // this value are that it is a power of two and greater than |sizeof(void*)|.
+  template <std::size_t Alignment>
+  struct AlignmentT : std::integral_constant<std::size_t, Alignment> {};
+};
+
+// Segregated-fit freelist allocator. Unlike |FreeList|, which keeps all free
+// blocks in a single address-ordered list and scans it linearly on every
+// request, this strategy buckets free blocks into an array of lists keyed by
+// power-of-two size class. A typical allocation indexes straight into its
+// class and pops the head of the first non-empty bucket at or above it, so
+// the common case costs O(1) pointer manipulations instead of an O(n) walk.
+// Only requests that land in a partially-filled class fall back to a
+// first-fit scan, and that scan is confined to the one bucket.
+//
+// The trade-off relative to |FreeList| is that returned blocks are filed by
+// size rather than address, so physically-adjacent free blocks are not
+// eagerly coalesced. Workloads with heavily mixed sizes and long-lived heaps
+// may prefer the coalescing behavior of |FreeList|.
+template <class Provider, class... Args>
+requires ProviderTrait<Provider>
+class SegregatedFreeList : public SegregatedFreeListParams {
+public:
+  static constexpr std::size_t kAlignment =
+      std::max({sizeof(void*), ntp::optional<AlignmentT<0>, Args...>::value});
+
+  SegregatedFreeList(Provider& provider) : provider_(provider) {}
+
+  ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(SegregatedFreeList);
+
+  Result<std::byte*> Find(Layout layout) noexcept {
+    if (!IsValid(layout))
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t request_size = internal::AlignUp(
+        layout.size + internal::GetBlockHeaderSize(), layout.alignment);
+
+    if (request_size > GetAlignedSize())
+      return cpp::fail(Error::SizeRequestTooLarge);
+
+    if (auto init = InitBlockIfUnset(); init.has_error())
+      return cpp::fail(init.error());
+
+    auto header_or = TakeFreeBlock(request_size);
+    if (header_or.has_error())
+      return cpp::fail(header_or.error());
+
+    internal::BlockHeader* header = header_or.value();
+    auto remainder_or =
+        internal::SplitBlock(header, request_size, layout.alignment);
+    if (remainder_or.has_error())
+      return cpp::fail(Error::Internal);
+
+    if (auto remainder = remainder_or.value(); remainder) {
+      remainder->next = nullptr;
+      InsertFreeBlock(remainder);
+    }
+
+    header->next = nullptr;
+    return internal::GetBlock(header);
+  }
+
+  Result<std::byte*> Find(std::size_t size) noexcept {
+    return Find(Layout(size, internal::kMinimumAlignment));
+  }
+
+  // Bulk allocation. Same-size requests repeatedly hit the same bucket, so
+  // the loop stays in cache; on failure every block handed out so far is
+  // filed back before the error surfaces.
+  Result<void> FindMany(Layout layout, std::span<std::byte*> out) noexcept {
+    if (out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      auto block_or = Find(layout);
+      if (block_or.has_error()) {
+        while (i > 0)
+          (void)Return(out[--i]);
+
+        return cpp::fail(block_or.error());
+      }
+
+      out[i] = block_or.value();
+    }
+
+    return {};
+  }
+
+  // Resize support here is limited by the absence of boundary tags: a
+  // block's physical neighbor cannot be identified, so growth always moves
+  // via allocate-copy-return. A request that still fits the block keeps its
+  // pointer; the slack is filed back into its size class when the block is
+  // eventually returned.
+  Result<std::byte*> Resize(std::byte* ptr, std::size_t new_size) {
+    if (ptr == nullptr || new_size == 0 || block_ == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    std::byte* low = internal::AsBytePtr(block_);
+    std::byte* high = internal::AsBytePtr(block_) + block_->size;
+    if (ptr < low || ptr > high)
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t request_size = internal::AlignUp(
+        new_size + internal::GetBlockHeaderSize(), internal::kMinimumAlignment);
+    if (request_size > GetAlignedSize())
+      return cpp::fail(Error::SizeRequestTooLarge);
+
+    auto* header = internal::GetHeader(ptr);
+    if (request_size <= header->size)
+      return ptr;
+
+    std::size_t old_payload = header->size - internal::GetBlockHeaderSize();
+    auto moved_or = Find(new_size);
+    if (moved_or.has_error())
+      return cpp::fail(moved_or.error());
+
+    std::memcpy(moved_or.value(), ptr, std::min(old_payload, new_size));
+    (void)Return(ptr);
+    return moved_or;
+  }
+
+  Result<void> Return(std::byte* ptr) {
+    if (ptr == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    std::byte* low = internal::AsBytePtr(block_);
+    std::byte* high = internal::AsBytePtr(block_) + block_->size;
+    if (ptr < low || ptr > high)
+      return cpp::fail(Error::InvalidInput);
+
+    InsertFreeBlock(internal::GetHeader(ptr));
+    return {};
+  }
+
+  Result<void> Reset() {
+    if (!block_)
+      return {};
+
+    auto release = [&](std::byte* p) -> internal::Failable<void> {
+      auto result = provider_.get().Return(p);
+      if (result.has_error()) {
+        DERROR("Block release failed: " << (int)result.error());
+        return cpp::fail(internal::Failure::ReleaseFailed);
+      }
+
+      return {};
+    };
+    if (auto result = internal::ReleaseBlockList(block_, std::move(release));
+        result.has_error())
+      return cpp::fail(Error::Internal);
+
+    block_ = nullptr;
+    buckets_.fill(nullptr);
+    return {};
+  }
+
+  constexpr bool AcceptsAlignment() const { return true; }
+
+  constexpr bool AcceptsReturn() const { return true; }
+
+private:
+  // Smallest size class tracked. Anything below this rounds up to the first
+  // bucket. The floor must hold a header plus one aligned chunk of payload.
+  static constexpr std::size_t kMinClassLog = 5;
+
+  // Largest size class is the whole provider block.
+  static constexpr std::size_t kMaxClassLog =
+      std::bit_width(Provider::GetBlockSize()) - 1;
+
+  static constexpr std::size_t kBucketCount = kMaxClassLog - kMinClassLog + 1;
+
+  // Ultimate size of the blocks after accounting for header and alignment.
+  [[nodiscard]] static constexpr std::size_t GetAlignedSize() {
+    return Provider::GetBlockSize();
+  }
+
+  // Bucket holding blocks of size [2^(kMinClassLog + i), 2^(kMinClassLog +
+  // i + 1)). Blocks within a bucket share a floor, not an exact size, so the
+  // requester's own bucket still needs a first-fit scan; every bucket above
+  // it is guaranteed to fit.
+  [[gnu::const]] static constexpr std::size_t GetBucketIndex(std::size_t size) {
+    std::size_t log = std::bit_width(size) - 1;
+    if (log <= kMinClassLog)
+      return 0;
+
+    return std::min(log - kMinClassLog, kBucketCount - 1);
+  }
+
+  void InsertFreeBlock(internal::BlockHeader* header) {
+    std::size_t index = GetBucketIndex(header->size);
+    header->next = buckets_[index];
+    buckets_[index] = header;
+  }
+
+  Result<internal::BlockHeader*> TakeFreeBlock(std::size_t request_size) {
+    std::size_t index = GetBucketIndex(request_size);
+
+    // The request's own class may hold blocks smaller than the request, so
+    // scan it first-fit before moving up.
+    if (buckets_[index]) {
+      auto fit_or = internal::FindBlockByFirstFit(buckets_[index],
+                                                  request_size);
+      if (fit_or.has_error())
+        return cpp::fail(Error::Internal);
+
+      if (auto fit = fit_or.value(); fit.has_value()) {
+        if (fit->prev)
+          fit->prev->next = fit->header->next;
+        else
+          buckets_[index] = fit->header->next;
+
+        return fit->header;
+      }
+    }
+
+    // Any block in a higher class is at least 2^(class floor) bytes, which
+    // is guaranteed to cover the request. Pop the head in O(1).
+    for (std::size_t i = index + 1; i < kBucketCount; ++i) {
+      if (!buckets_[i])
+        continue;
+
+      internal::BlockHeader* header = buckets_[i];
+      buckets_[i] = header->next;
+      return header;
+    }
+
+    return cpp::fail(Error::NoFreeBlock);
+  }
+
+  Result<void> InitBlockIfUnset() {
+    if (block_)
+      return {};
+
+    Result<std::byte*> base_or = provider_.get().Provide(1);
+    if (base_or.has_error())
+      return cpp::fail(base_or.error());
+
+    auto allocation = internal::VirtualAddressRange{
+        .address = reinterpret_cast<std::uint64_t>(base_or.value()),
+        .count = GetAlignedSize() / internal::GetPageSize()};
+    block_ = internal::BlockHeader::Create(allocation);
+
+    auto* free_block =
+        internal::PtrAdd(block_, internal::GetBlockHeaderSize());
+    free_block->next = nullptr;
+    free_block->size = block_->size - internal::GetBlockHeaderSize();
+    InsertFreeBlock(free_block);
+    return {};
+  }
+
+  // Various assertions hidden from user API but added here to ensure invariants
+  // are met at compile time.
+  static_assert(internal::IsPowerOfTwo(kAlignment),
+                "kAlignment must be a power of 2.");
+
+  std::reference_wrapper<Provider> provider_;
+
+  internal::BlockHeader* block_ = nullptr;
+
+  // Heads of the per-class free lists.
+  std::array<internal::BlockHeader*, kBucketCount> buckets_ = {nullptr};
+};
+
+} // namespace allocators::strategy
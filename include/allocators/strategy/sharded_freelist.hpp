@@ -0,0 +1,182 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+
+#include <template/optional.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/common/trait.hpp>
+#include <allocators/internal/util.hpp>
+#include <allocators/strategy/freelist.hpp>
+
+namespace allocators::strategy {
+
+struct ShardedFreeListParams {
+  static constexpr std::size_t kDefaultShardCount = 8;
+
+  // Number of independent freelist shards. Must be a power of two. More
+  // shards mean less lock contention but more memory parked in
+  // partially-used blocks.
+  template <std::size_t N>
+  struct ShardsT : std::integral_constant<std::size_t, N> {};
+};
+
+// Thread-safe freelist strategy for shared, long-lived heaps. Rather than a
+// single list behind one lock, allocations are spread over an array of
+// independent |FreeList| shards, each with its own mutex and its own blocks
+// from the shared provider. A thread hashes to a home shard, so under
+// steady load threads rarely touch the same lock; when a shard runs dry the
+// caller steals from the other shards in order. Return routes the pointer
+// to whichever shard owns it via each shard's range check.
+//
+// The provider must itself be thread-safe (e.g. |LockFreePage|). Remaining
+// FreeList parameters — alignment, search policy, statistics — pass through
+// to every shard unchanged.
+template <class Provider, class... Args>
+requires ProviderTrait<Provider>
+class ShardedFreeList : public ShardedFreeListParams {
+public:
+  static constexpr std::size_t kShardCount = std::max(
+      {kDefaultShardCount, ntp::optional<ShardsT<0>, Args...>::value});
+
+  explicit ShardedFreeList(Provider& provider) : provider_(provider) {
+    for (auto& shard : shards_)
+      shard.list.emplace(provider);
+  }
+
+  ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(ShardedFreeList);
+
+  Result<std::byte*> Find(Layout layout) noexcept {
+    if (!IsValid(layout))
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t home = GetHomeShard();
+    Error last_error = Error::NoFreeBlock;
+    for (std::size_t i = 0; i < kShardCount; ++i) {
+      Shard& shard = shards_[(home + i) & (kShardCount - 1)];
+      std::scoped_lock lock(shard.mutex);
+      auto result = shard.list->Find(layout);
+      if (result.has_value())
+        return result;
+
+      // Only exhaustion justifies stealing from a sibling shard; anything
+      // else would fail there just the same.
+      if (result.error() != Error::NoFreeBlock &&
+          result.error() != Error::OutOfMemory)
+        return result;
+
+      last_error = result.error();
+    }
+
+    return cpp::fail(last_error);
+  }
+
+  Result<std::byte*> Find(std::size_t size) noexcept {
+    return Find(Layout(size, internal::kMinimumAlignment));
+  }
+
+  // Bulk allocation. The whole batch is served from one shard under a
+  // single lock acquisition, so the per-allocation locking cost is
+  // amortized over the batch. The underlying freelist unwinds partial
+  // batches itself, so falling over to a sibling shard is safe.
+  Result<void> FindMany(Layout layout, std::span<std::byte*> out) noexcept {
+    if (!IsValid(layout) || out.empty())
+      return cpp::fail(Error::InvalidInput);
+
+    std::size_t home = GetHomeShard();
+    Error last_error = Error::NoFreeBlock;
+    for (std::size_t i = 0; i < kShardCount; ++i) {
+      Shard& shard = shards_[(home + i) & (kShardCount - 1)];
+      std::scoped_lock lock(shard.mutex);
+      auto result = shard.list->FindMany(layout, out);
+      if (result.has_value())
+        return result;
+
+      if (result.error() != Error::NoFreeBlock &&
+          result.error() != Error::OutOfMemory)
+        return result;
+
+      last_error = result.error();
+    }
+
+    return cpp::fail(last_error);
+  }
+
+  // Routes the resize to the owning shard, whose freelist grows in place
+  // when the physical successor is free; a moved block stays within its
+  // shard. Ownership is discovered the same way Return discovers it: every
+  // shard but the owner rejects the pointer.
+  Result<std::byte*> Resize(std::byte* ptr, std::size_t new_size) {
+    if (ptr == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    for (auto& shard : shards_) {
+      std::scoped_lock lock(shard.mutex);
+      auto result = shard.list->Resize(ptr, new_size);
+      if (result.has_value() || result.error() != Error::InvalidInput)
+        return result;
+    }
+
+    return cpp::fail(Error::InvalidInput);
+  }
+
+  Result<void> Return(std::byte* ptr) {
+    if (ptr == nullptr)
+      return cpp::fail(Error::InvalidInput);
+
+    // Each shard rejects pointers outside its own blocks, so probing them
+    // in order is safe; only the owner will accept.
+    for (auto& shard : shards_) {
+      std::scoped_lock lock(shard.mutex);
+      if (auto result = shard.list->Return(ptr); result.has_value())
+        return result;
+    }
+
+    return cpp::fail(Error::InvalidInput);
+  }
+
+  Result<void> Reset() {
+    for (auto& shard : shards_) {
+      std::scoped_lock lock(shard.mutex);
+      if (auto result = shard.list->Reset(); result.has_error())
+        return result;
+    }
+
+    return {};
+  }
+
+  constexpr bool AcceptsAlignment() const { return true; }
+
+  constexpr bool AcceptsReturn() const { return false; }
+
+private:
+  struct Shard {
+    std::mutex mutex;
+    // Deferred construction: FreeList has no default constructor and is
+    // pinned (no copy, no move), so the array is built empty and each list
+    // is emplaced against the provider.
+    std::optional<FreeList<Provider, Args...>> list;
+  };
+
+  static std::size_t GetHomeShard() {
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) &
+           (kShardCount - 1);
+  }
+
+  // Various assertions hidden from user API but added here to ensure
+  // invariants are met at compile time.
+  static_assert(internal::IsPowerOfTwo(kShardCount),
+                "kShardCount must be a power of 2.");
+
+  std::reference_wrapper<Provider> provider_;
+
+  std::array<Shard, kShardCount> shards_;
+};
+
+} // namespace allocators::strategy
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+
+#include <template/parameters.hpp>
+
+#include <allocators/common/error.hpp>
+#include <allocators/common/trace.hpp>
+#include <allocators/common/trait.hpp>
+#include <allocators/internal/util.hpp>
+
+namespace allocators::strategy {
+
+// Recording decorator: wraps any StrategyTrait class and appends a
+// TraceEvent to a TraceLog for every successful Find, Return, and Reset
+// flowing through it, so a production workload can be captured once and
+// handed to the maintainers as a replayable reproducer (see the replay
+// driver under tests/performance/). A Resize is logged as the Return/Find
+// pair it is equivalent to under replay.
+//
+// The hook is a compile-time choice like the other parameter-pack knobs: a
+// build that doesn't wrap its strategy pays nothing at all, and a build
+// that does pays one branch and one store into preallocated storage per
+// event. The wrapper satisfies StrategyTrait itself, so it drops into
+// adapters and tests anywhere the bare strategy would.
+//
+// The log is borrowed, not owned, and must outlive the wrapper. Tracing a
+// thread-safe strategy from several threads needs one wrapper (and one
+// log) per thread; TraceLog itself is not synchronized.
+template <class Strategy>
+requires StrategyTrait<Strategy>
+class Traced {
+public:
+  Traced(Strategy& strategy, TraceLog& log)
+      : strategy_(strategy), log_(log) {}
+
+  ALLOCATORS_NO_COPY_NO_MOVE_NO_DEFAULT(Traced);
+
+  Result<std::byte*> Find(Layout layout) noexcept {
+    auto result = strategy_.get().Find(layout);
+    if (result.has_value())
+      RecordFind(layout, result.value());
+
+    return result;
+  }
+
+  Result<std::byte*> Find(std::size_t size) noexcept {
+    return Find(Layout(size, internal::kMinimumAlignment));
+  }
+
+  Result<void> FindMany(Layout layout, std::span<std::byte*> out) noexcept {
+    auto result = strategy_.get().FindMany(layout, out);
+    if (result.has_value())
+      for (std::byte* block : out)
+        RecordFind(layout, block);
+
+    return result;
+  }
+
+  Result<std::byte*> Resize(std::byte* ptr, std::size_t new_size) {
+    auto result = strategy_.get().Resize(ptr, new_size);
+    if (result.has_value()) {
+      RecordReturn(ptr);
+      RecordFind(Layout(new_size, internal::kMinimumAlignment),
+                 result.value());
+    }
+
+    return result;
+  }
+
+  Result<void> Return(std::byte* ptr) {
+    auto result = strategy_.get().Return(ptr);
+    if (result.has_value())
+      RecordReturn(ptr);
+
+    return result;
+  }
+
+  Result<void> Reset() {
+    auto result = strategy_.get().Reset();
+    if (result.has_value())
+      log_.get().Append(TraceEvent{.kind = TraceEvent::Kind::Reset});
+
+    return result;
+  }
+
+  constexpr bool AcceptsAlignment() const {
+    return strategy_.get().AcceptsAlignment();
+  }
+
+  constexpr bool AcceptsReturn() const {
+    return strategy_.get().AcceptsReturn();
+  }
+
+private:
+  void RecordFind(Layout layout, std::byte* block) {
+    log_.get().Append(TraceEvent{
+        .kind = TraceEvent::Kind::Find,
+        .alignment = static_cast<std::uint16_t>(layout.alignment),
+        .size = static_cast<std::uint32_t>(layout.size),
+        .address = reinterpret_cast<std::uint64_t>(block)});
+  }
+
+  void RecordReturn(std::byte* ptr) {
+    log_.get().Append(
+        TraceEvent{.kind = TraceEvent::Kind::Return,
+                   .address = reinterpret_cast<std::uint64_t>(ptr)});
+  }
+
+  std::reference_wrapper<Strategy> strategy_;
+  std::reference_wrapper<TraceLog> log_;
+};
+
+} // namespace allocators::strategy
@@ -0,0 +1,85 @@
+#include "catch2/catch_all.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/lock_free_bump.hpp>
+
+#include "../histogram.hpp"
+#include "../util.hpp"
+
+using namespace allocators;
+
+namespace {
+
+// Per-thread capture: timestamps go into a preallocated buffer so the
+// record path is a clock read and a store — no allocation, no shared
+// state — and aggregation into histograms happens after the threads join.
+std::vector<std::uint64_t> CaptureFindLatencies(
+    strategy::LockFreeBump<provider::LockFreePage<>>& allocator,
+    std::size_t operations) {
+  std::vector<std::uint64_t> samples;
+  samples.reserve(operations);
+
+  for (std::size_t i = 0; i < operations; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    auto result = allocator.Find<64>();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(result.has_value());
+    samples.push_back(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+            .count()));
+  }
+
+  return samples;
+}
+
+} // namespace
+
+TEST_CASE("LockFreeBump allocation tail latency across thread counts",
+          "[concurrency][latency][LockFreeBump]") {
+  static constexpr std::size_t kOperationsPerThread = 20'000;
+  static constexpr std::array kThreadCounts = {1ul, 8ul, 32ul};
+
+  for (std::size_t thread_count : kThreadCounts) {
+    provider::LockFreePage<> provider;
+    strategy::LockFreeBump<provider::LockFreePage<>> allocator(provider);
+
+    std::vector<std::vector<std::uint64_t>> per_thread(thread_count);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t)
+      threads.emplace_back([&, t] {
+        per_thread[t] = CaptureFindLatencies(allocator, kOperationsPerThread);
+      });
+
+    for (auto& thread : threads)
+      thread.join();
+
+    testing::LatencyHistogram histogram;
+    for (const auto& samples : per_thread)
+      histogram.Record(samples);
+
+    REQUIRE(histogram.GetCount() == thread_count * kOperationsPerThread);
+
+    std::uint64_t p50 = histogram.GetPercentile(0.50);
+    std::uint64_t p99 = histogram.GetPercentile(0.99);
+    std::uint64_t p999 = histogram.GetPercentile(0.999);
+    REQUIRE(p50 <= p99);
+    REQUIRE(p99 <= p999);
+
+    // The numbers themselves are the deliverable: contention-induced CAS
+    // retries show up as the gap between p50 and p999 widening with the
+    // thread count.
+    WARN("LockFreeBump Find latency, " << thread_count << " threads: p50="
+                                       << p50 << "ns p99=" << p99
+                                       << "ns p999=" << p999 << "ns");
+
+    REQUIRE(allocator.Reset().has_value());
+  }
+}
@@ -0,0 +1,89 @@
+#include "catch2/catch_all.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/remote_free_bump.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+using ProviderUnderTest =
+    provider::LockFreePage<provider::LockFreePageParams::StatisticsT<true>>;
+using AllocatorUnderTest =
+    strategy::RemoteFreeBump<ProviderUnderTest, StatsParams::StatisticsT<true>>;
+
+TEST_CASE("RemoteFreeBump releases fully-freed blocks back to the provider",
+          "[concurrency][allocator][RemoteFreeBump]") {
+  ProviderUnderTest provider;
+  AllocatorUnderTest allocator(provider);
+
+  // Fill several blocks, then free every object from another thread.
+  static constexpr std::size_t kCount = 512;
+  std::vector<std::byte*> ptrs;
+  for (std::size_t i = 0; i < kCount; ++i)
+    ptrs.push_back(GetValueOrFail<std::byte*>(allocator.Find(64)));
+
+  std::thread consumer([&] {
+    for (auto* p : ptrs)
+      REQUIRE(allocator.Return(p).has_value());
+  });
+  consumer.join();
+
+  // Subsequent Finds drain the remote stacks and hand the dead blocks back.
+  std::uint64_t released_before = provider.GetStatistics().release_count;
+  for (std::size_t i = 0; i < kCount; ++i)
+    REQUIRE(allocator.Find(64).has_value());
+
+  REQUIRE(provider.GetStatistics().release_count > released_before);
+
+  REQUIRE(allocator.Reset().has_value());
+
+  // The outstanding-bytes gauge converges once everything is reclaimed:
+  // frees are counted in Return, bytes when their block dies.
+  REQUIRE(allocator.GetStatistics().bytes_outstanding.load() == 0);
+}
+
+TEST_CASE("RemoteFreeBump sustains a producer/consumer pipeline",
+          "[concurrency][allocator][RemoteFreeBump]") {
+  static constexpr std::size_t kMessages = 100'000;
+
+  ProviderUnderTest provider;
+  AllocatorUnderTest allocator(provider);
+
+  // Single-slot mailbox: the producer owns Find, the consumer only calls
+  // Return — the supported split.
+  std::atomic<std::byte*> mailbox{nullptr};
+
+  std::thread consumer([&] {
+    std::size_t freed = 0;
+    while (freed < kMessages) {
+      std::byte* message =
+          mailbox.exchange(nullptr, std::memory_order_acquire);
+      if (message == nullptr)
+        continue;
+
+      REQUIRE(allocator.Return(message).has_value());
+      ++freed;
+    }
+  });
+
+  std::size_t sent = 0;
+  while (sent < kMessages) {
+    std::byte* message = GetValueOrFail<std::byte*>(allocator.Find(48));
+    std::byte* expected = nullptr;
+    if (mailbox.compare_exchange_strong(expected, message,
+                                        std::memory_order_release))
+      ++sent;
+    else
+      REQUIRE(allocator.Return(message).has_value());
+  }
+
+  consumer.join();
+  REQUIRE(allocator.Reset().has_value());
+  REQUIRE(allocator.GetStatistics().bytes_outstanding.load() == 0);
+}
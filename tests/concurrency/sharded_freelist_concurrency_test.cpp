@@ -0,0 +1,54 @@
+#include "catch2/catch_all.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/sharded_freelist.hpp>
+
+using namespace allocators;
+
+using AllocatorUnderTest =
+    strategy::ShardedFreeList<provider::LockFreePage<>>;
+
+TEST_CASE("Sharded freelist works in multi-threaded contexts",
+          "[concurrency][allocator][ShardedFreeList]") {
+  static constexpr std::size_t kMaximumOps = 100;
+  static constexpr std::size_t kNumThreads = 8;
+  static constexpr std::size_t kRequestSize = 64;
+
+  provider::LockFreePage<> provider;
+  AllocatorUnderTest allocator(provider);
+  // Mutex used for calling Catch2's APIs
+  std::mutex catch_mutex;
+
+  auto allocate_and_release = [&]() {
+    for (std::size_t i = 0; i < kMaximumOps; ++i) {
+      auto p_or = allocator.Find(kRequestSize);
+      if (p_or.has_error()) {
+        std::scoped_lock lock(catch_mutex);
+        INFO("[" << std::this_thread::get_id()
+                 << "] Allocation failed: " << ToString(p_or.error()));
+        FAIL();
+      }
+
+      auto result = allocator.Return(p_or.value());
+      if (result.has_error()) {
+        std::scoped_lock lock(catch_mutex);
+        INFO("[" << std::this_thread::get_id()
+                 << "] Release failed: " << ToString(result.error()));
+        FAIL();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (auto i = 0ul; i < kNumThreads; ++i)
+    threads.emplace_back(allocate_and_release);
+
+  for (auto& th : threads)
+    th.join();
+
+  REQUIRE(allocator.Reset().has_value());
+}
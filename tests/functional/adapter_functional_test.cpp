@@ -1,23 +1,75 @@
 #include "catch2/catch_all.hpp"
 
+#include <memory_resource>
+#include <unordered_map>
 #include <vector>
 
 #include <allocators/adapter/adapter.hpp>
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/freelist.hpp>
+#include <allocators/strategy/lock_free_bump.hpp>
 
 using namespace allocators;
 
 using T = long;
 
-TEST_CASE("BumpAdapter allocator works with standard containers",
-          "[functional][allocator][BumpAdapter]") {
-  SECTION("A fixed-sized allocator that can hold a page worth of objects") {
-    static constexpr std::size_t PageSize = 4096;
-    using AllocatorUnderTest = adapter::BumpAdapter<T, SizeT<PageSize>>;
+TEST_CASE("StrategyAdapter works with standard containers",
+          "[functional][allocator][StrategyAdapter]") {
+  provider::LockFreePage<> provider;
 
-    std::vector<T, AllocatorUnderTest> values;
-    for (size_t i = 0; i < 100; ++i)
+  SECTION("std::vector on LockFreeBump") {
+    using Strategy = strategy::LockFreeBump<provider::LockFreePage<>>;
+    Strategy allocator(provider);
+
+    std::vector<T, adapter::StrategyAdapter<T, Strategy>> values(
+        (adapter::StrategyAdapter<T, Strategy>(allocator)));
+    for (std::size_t i = 0; i < 100; ++i)
       values.push_back(i);
 
-    SUCCEED(); // Should not panic here.
+    for (std::size_t i = 0; i < 100; ++i)
+      REQUIRE(values[i] == static_cast<T>(i));
+
+    values = {};
+    REQUIRE(allocator.Reset().has_value());
+  }
+
+  SECTION("Node-based container rebinds against FreeList") {
+    using Strategy = strategy::FreeList<provider::LockFreePage<>>;
+    Strategy allocator(provider);
+
+    using Allocator =
+        adapter::StrategyAdapter<std::pair<const T, T>, Strategy>;
+    std::unordered_map<T, T, std::hash<T>, std::equal_to<T>, Allocator> map(
+        8, std::hash<T>(), std::equal_to<T>(), Allocator(allocator));
+    for (T i = 0; i < 50; ++i)
+      map[i] = i * 2;
+
+    for (T i = 0; i < 50; ++i)
+      REQUIRE(map[i] == i * 2);
+
+    map.clear();
   }
 }
+
+TEST_CASE("StrategyMemoryResource works with pmr containers",
+          "[functional][allocator][StrategyMemoryResource]") {
+  provider::LockFreePage<> provider;
+  using Strategy = strategy::FreeList<provider::LockFreePage<>>;
+  Strategy allocator(provider);
+
+  adapter::StrategyMemoryResource<Strategy> resource(allocator);
+
+  std::pmr::vector<T> values(&resource);
+  for (std::size_t i = 0; i < 100; ++i)
+    values.push_back(i);
+
+  for (std::size_t i = 0; i < 100; ++i)
+    REQUIRE(values[i] == static_cast<T>(i));
+
+  std::pmr::unordered_map<T, T> map(&resource);
+  for (T i = 0; i < 50; ++i)
+    map[i] = i * 3;
+
+  for (T i = 0; i < 50; ++i)
+    REQUIRE(map[i] == i * 3);
+}
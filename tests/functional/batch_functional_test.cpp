@@ -0,0 +1,107 @@
+#include <array>
+#include <cstddef>
+
+#include "catch2/catch_all.hpp"
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/freelist.hpp>
+#include <allocators/strategy/lock_free_bump.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+static constexpr std::size_t kBatchSize = 32;
+static constexpr std::size_t kRequestSize = 64;
+
+TEST_CASE("LockFreeBump fills a whole batch from one block",
+          "[functional][batch][LockFreeBump]") {
+  provider::LockFreePage<> provider;
+  strategy::LockFreeBump<provider::LockFreePage<>> allocator(provider);
+
+  std::array<std::byte*, kBatchSize> batch = {nullptr};
+  REQUIRE(allocator
+              .FindMany(Layout(kRequestSize, internal::kMinimumAlignment),
+                        batch)
+              .has_value());
+
+  // Entries reserved in one CAS are consecutive within the block.
+  for (std::size_t i = 0; i < kBatchSize; ++i) {
+    REQUIRE(batch[i] != nullptr);
+    if (i > 0)
+      REQUIRE(batch[i] == batch[i - 1] + kRequestSize);
+  }
+
+  REQUIRE(allocator.Reset().has_value());
+}
+
+TEST_CASE("FreeList returns partial batches on failure",
+          "[functional][batch][FreeList]") {
+  provider::LockFreePage<> provider;
+  strategy::FreeList<provider::LockFreePage<>> allocator(provider);
+
+  std::array<std::byte*, kBatchSize> batch = {nullptr};
+  REQUIRE(allocator
+              .FindMany(Layout(kRequestSize, internal::kMinimumAlignment),
+                        batch)
+              .has_value());
+
+  for (auto* block : batch)
+    REQUIRE(allocator.Return(block).has_value());
+
+  // A batch that cannot fit in the block fails without leaking; the heap is
+  // fully reclaimed so a fresh batch still succeeds.
+  std::array<std::byte*, kBatchSize> oversized = {nullptr};
+  REQUIRE(allocator
+              .FindMany(Layout(provider.GetBlockSize() / 8,
+                               internal::kMinimumAlignment),
+                        oversized)
+              .has_error());
+
+  REQUIRE(allocator
+              .FindMany(Layout(kRequestSize, internal::kMinimumAlignment),
+                        batch)
+              .has_value());
+  for (auto* block : batch)
+    REQUIRE(allocator.Return(block).has_value());
+
+  REQUIRE(allocator.Reset().has_value());
+}
+
+TEST_CASE("LockFreePage provides a batch of distinct pages",
+          "[functional][batch][LockFreePage]") {
+  provider::LockFreePage<> provider;
+
+  std::array<std::byte*, kBatchSize> batch = {nullptr};
+  REQUIRE(provider.ProvideMany(1, batch).has_value());
+
+  for (std::size_t i = 0; i < kBatchSize; ++i) {
+    REQUIRE(batch[i] != nullptr);
+    for (std::size_t j = i + 1; j < kBatchSize; ++j)
+      REQUIRE(batch[i] != batch[j]);
+  }
+
+  for (auto* page : batch)
+    REQUIRE(provider.Return(page).has_value());
+}
+
+TEST_CASE("LockFreePage splices a returned batch in one operation",
+          "[functional][batch][LockFreePage]") {
+  provider::LockFreePage<> provider;
+
+  std::array<std::byte*, kBatchSize> batch = {nullptr};
+  REQUIRE(provider.ProvideMany(1, batch).has_value());
+  REQUIRE(provider.ReturnMany(batch).has_value());
+
+  // The spliced pages are recycled off the free list.
+  for (std::size_t i = 0; i < kBatchSize; ++i) {
+    std::byte* page = GetValueOrFail<std::byte*>(provider.Provide(1));
+    REQUIRE(provider.Return(page).has_value());
+  }
+
+  // A batch containing a foreign pointer is rejected without touching the
+  // heap.
+  std::byte foreign;
+  std::array<std::byte*, 1> bad = {&foreign};
+  REQUIRE(provider.ReturnMany(bad).has_error());
+}
@@ -85,3 +85,36 @@ TEST_CASE("BlockMap returns std::nullopt if given unknown key",
   auto actual_or = block_as_map->Take(va_range.address);
   REQUIRE(!actual_or.has_value());
 }
+
+TEST_CASE("BlockMap round-trips many distinct keys",
+          "[functional][internal][BlockMap]") {
+  TypedBlockMap* block_as_map = AsBlockMapPtr<kBlockSize>(GetBlockZeroedOut());
+
+  for (std::uint64_t i = 1; i <= 300; ++i)
+    REQUIRE(block_as_map->Insert(
+        VirtualAddressRange{.address = i * kBlockSize, .count = 1}));
+
+  for (std::uint64_t i = 300; i >= 1; --i) {
+    auto actual_or = block_as_map->Take(i * kBlockSize);
+    REQUIRE(actual_or.has_value());
+    REQUIRE(actual_or.value().address == i * kBlockSize);
+  }
+
+  REQUIRE(block_as_map->IsEmpty());
+}
+
+TEST_CASE("BlockMap slots freed by Take are reused",
+          "[functional][internal][BlockMap]") {
+  TypedBlockMap* block_as_map = AsBlockMapPtr<kBlockSize>(GetBlockZeroedOut());
+
+  // Far more operations than capacity, so this only passes if deleted
+  // slots are recycled.
+  for (std::uint64_t i = 0; i < 4 * block_as_map->GetCapacity(); ++i) {
+    VirtualAddressRange va_range = {.address = (i % 7 + 1) * kBlockSize,
+                                    .count = 1};
+    REQUIRE(block_as_map->Insert(va_range));
+    REQUIRE(block_as_map->Take(va_range.address).has_value());
+  }
+
+  REQUIRE(block_as_map->IsEmpty());
+}
@@ -0,0 +1,51 @@
+#include <cstddef>
+
+#include "catch2/catch_all.hpp"
+
+#include <allocators/provider/caching_page.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+TEST_CASE("CachingPage recycles returned blocks",
+          "[functional][provider][CachingPage]") {
+  provider::CachingPage<> provider;
+
+  SECTION("Can provide and return a single page") {
+    std::byte* page = GetValueOrFail<std::byte*>(provider.Provide(1));
+    REQUIRE(provider.Return(page).has_value());
+  }
+
+  SECTION("A returned block is served again without a fresh mapping") {
+    std::byte* first = GetValueOrFail<std::byte*>(provider.Provide(1));
+    REQUIRE(provider.Return(first).has_value());
+
+    std::byte* second = GetValueOrFail<std::byte*>(provider.Provide(1));
+    REQUIRE(first == second);
+    REQUIRE(provider.Return(second).has_value());
+  }
+
+  SECTION("Recycling matches the page count exactly") {
+    std::byte* small = GetValueOrFail<std::byte*>(provider.Provide(1));
+    std::byte* large = GetValueOrFail<std::byte*>(provider.Provide(4));
+    REQUIRE(provider.Return(small).has_value());
+    REQUIRE(provider.Return(large).has_value());
+
+    std::byte* recycled = GetValueOrFail<std::byte*>(provider.Provide(4));
+    REQUIRE(recycled == large);
+
+    // A recycled block is writable end to end.
+    recycled[0] = std::byte(0xAA);
+    recycled[4 * internal::GetPageSize() - 1] = std::byte(0xBB);
+
+    REQUIRE(provider.Return(recycled).has_value());
+  }
+
+  SECTION("Unknown pointers are rejected") {
+    std::byte* page = GetValueOrFail<std::byte*>(provider.Provide(1));
+    REQUIRE(provider.Return(page + internal::GetPageSize()) ==
+            cpp::fail(Error::InvalidInput));
+    REQUIRE(provider.Return(page).has_value());
+  }
+}
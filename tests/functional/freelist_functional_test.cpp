@@ -1,5 +1,7 @@
 #include <array>
 #include <cstddef>
+#include <cstring>
+#include <vector>
 
 #include "catch2/catch_all.hpp"
 #include "magic_enum.hpp"
@@ -30,8 +32,6 @@ using FixedFreeListAllocators = AllocatorPack<FixedFreeList<>>;
 TEMPLATE_LIST_TEST_CASE("Fixed FreeList allocator that can fit N objects",
                         "[allocator][FreeList][fixed]",
                         FixedFreeListAllocators) {
-  // TODO: Enable once fixed.
-  SKIP();
   provider::LockFreePage<> provider;
   TestType allocator(provider);
 
@@ -57,3 +57,182 @@ TEMPLATE_LIST_TEST_CASE("Fixed FreeList allocator that can fit N objects",
     }
   }
 }
+
+TEST_CASE("FreeList grows past one provider block and shrinks back",
+          "[allocator][FreeList][growth]") {
+  using CountingPage = provider::LockFreePage<StatsParams::StatisticsT<true>>;
+  CountingPage provider;
+  strategy::FreeList<CountingPage, StatsParams::StatisticsT<true>> allocator(
+      provider);
+
+  // Three blocks' worth of requests: exhausting the first block must fetch
+  // more from the provider instead of failing with NoFreeBlock.
+  static constexpr std::size_t kRequestSize = 512;
+  std::size_t count = 3 * provider.GetBlockSize() / kRequestSize;
+
+  std::vector<std::byte*> allocs(count);
+  for (std::size_t i = 0; i < count; ++i)
+    allocs[i] = GetValueOrFail<std::byte*>(allocator.Find(kRequestSize));
+
+  REQUIRE(allocator.GetStatistics().provider_round_trips.load() >= 3);
+
+  // Releasing everything hands the fully-free blocks back to the provider
+  // rather than keeping peak provisioning resident.
+  for (std::size_t i = 0; i < count; ++i)
+    REQUIRE(allocator.Return(allocs[i]).has_value());
+
+  REQUIRE(allocator.GetStatistics().bytes_outstanding.load() == 0);
+  REQUIRE(provider.GetStatistics().bytes_outstanding.load() == 0);
+
+  // And the allocator is still usable afterwards.
+  std::byte* block = GetValueOrFail<std::byte*>(allocator.Find(kRequestSize));
+  REQUIRE(allocator.Return(block).has_value());
+}
+
+TEST_CASE("FreeList resizes allocations in place where possible",
+          "[allocator][FreeList][resize]") {
+  provider::LockFreePage<> provider;
+  strategy::FreeList<provider::LockFreePage<>> allocator(provider);
+
+  std::byte* first = GetValueOrFail<std::byte*>(allocator.Find(64));
+  std::byte* second = GetValueOrFail<std::byte*>(allocator.Find(64));
+  std::byte* third = GetValueOrFail<std::byte*>(allocator.Find(64));
+  std::memset(first, 0x5A, 64);
+
+  SECTION("Growth absorbs a free physical successor without moving") {
+    REQUIRE(allocator.Return(second).has_value());
+
+    std::byte* grown = GetValueOrFail<std::byte*>(allocator.Resize(first, 96));
+    REQUIRE(grown == first);
+    for (std::size_t i = 0; i < 64; ++i)
+      REQUIRE(first[i] == std::byte(0x5A));
+
+    REQUIRE(allocator.Return(grown).has_value());
+    REQUIRE(allocator.Return(third).has_value());
+  }
+
+  SECTION("Shrinking trims the tail back onto the free list") {
+    std::byte* shrunk = GetValueOrFail<std::byte*>(allocator.Resize(first, 16));
+    REQUIRE(shrunk == first);
+
+    // The trimmed remainder is free again: the neighbor can grow into it.
+    REQUIRE(allocator.Return(first).has_value());
+    REQUIRE(allocator.Return(second).has_value());
+    REQUIRE(allocator.Return(third).has_value());
+  }
+
+  SECTION("An occupied successor forces a move that preserves contents") {
+    std::byte* moved = GetValueOrFail<std::byte*>(allocator.Resize(first, 512));
+    REQUIRE(moved != first);
+    for (std::size_t i = 0; i < 64; ++i)
+      REQUIRE(moved[i] == std::byte(0x5A));
+
+    REQUIRE(allocator.Return(moved).has_value());
+    REQUIRE(allocator.Return(second).has_value());
+    REQUIRE(allocator.Return(third).has_value());
+  }
+
+  SECTION("Growth past the block size moves onto the large-object path") {
+    std::byte* moved = GetValueOrFail<std::byte*>(
+        allocator.Resize(first, provider.GetBlockSize() * 2));
+    REQUIRE(moved != first);
+    for (std::size_t i = 0; i < 64; ++i)
+      REQUIRE(moved[i] == std::byte(0x5A));
+
+    REQUIRE(allocator.Return(moved).has_value());
+    REQUIRE(allocator.Return(second).has_value());
+    REQUIRE(allocator.Return(third).has_value());
+  }
+
+  SECTION("Malformed requests are rejected") {
+    REQUIRE(allocator.Resize(nullptr, 64) == cpp::fail(Error::InvalidInput));
+
+    REQUIRE(allocator.Return(first).has_value());
+    REQUIRE(allocator.Return(second).has_value());
+    REQUIRE(allocator.Return(third).has_value());
+  }
+}
+
+TEST_CASE("FreeList serves oversized requests through the provider",
+          "[allocator][FreeList][large]") {
+  using CountingPage = provider::LockFreePage<StatsParams::StatisticsT<true>>;
+  CountingPage provider;
+  strategy::FreeList<CountingPage> allocator(provider);
+
+  // Five blocks' worth in one request: previously SizeRequestTooLarge.
+  std::size_t large_size = 5 * provider.GetBlockSize();
+  std::byte* large = GetValueOrFail<std::byte*>(allocator.Find(large_size));
+  std::memset(large, 0x3C, large_size);
+
+  // Small allocations keep working alongside, out of the heap chain.
+  std::byte* small = GetValueOrFail<std::byte*>(allocator.Find(64));
+  REQUIRE(large[large_size - 1] == std::byte(0x3C));
+
+  // Return releases exactly the run that was provided.
+  REQUIRE(allocator.Return(large).has_value());
+  REQUIRE(allocator.Return(large) == cpp::fail(Error::InvalidInput));
+  REQUIRE(allocator.Return(small).has_value());
+  REQUIRE(provider.GetStatistics().bytes_outstanding.load() == 0);
+}
+
+TEST_CASE("FreeList validation mode rejects double frees and foreign pointers",
+          "[allocator][FreeList][validation]") {
+  provider::LockFreePage<> provider;
+  strategy::FreeList<provider::LockFreePage<>,
+                     strategy::FreeListParams::ValidationT<true>>
+      allocator(provider);
+
+  std::byte* first = GetValueOrFail<std::byte*>(allocator.Find(64));
+  std::byte* second = GetValueOrFail<std::byte*>(allocator.Find(64));
+
+  SECTION("A double free is rejected without corrupting the list") {
+    REQUIRE(allocator.Return(first).has_value());
+    REQUIRE(allocator.Return(first) == cpp::fail(Error::InvalidInput));
+
+    // The list survived: the other allocation still comes back cleanly.
+    REQUIRE(allocator.Return(second).has_value());
+  }
+
+  SECTION("An interior pointer is rejected") {
+    REQUIRE(allocator.Return(first + 8) == cpp::fail(Error::InvalidInput));
+    REQUIRE(allocator.Resize(first + 8, 128) ==
+            cpp::fail(Error::InvalidInput));
+
+    REQUIRE(allocator.Return(first).has_value());
+    REQUIRE(allocator.Return(second).has_value());
+  }
+
+  SECTION("A one-past-the-end pointer is rejected") {
+    // Page-provider blocks are naturally aligned, so the owning block's
+    // end is computable from any allocation inside it.
+    std::byte* end = reinterpret_cast<std::byte*>(internal::AlignDown(
+                         reinterpret_cast<std::size_t>(first),
+                         provider.GetBlockSize())) +
+                     provider.GetBlockSize();
+    REQUIRE(allocator.Return(end) == cpp::fail(Error::InvalidInput));
+    REQUIRE(allocator.Resize(end, 128) == cpp::fail(Error::InvalidInput));
+
+    REQUIRE(allocator.Return(first).has_value());
+    REQUIRE(allocator.Return(second).has_value());
+  }
+
+  SECTION("Resize keeps the occupancy bit with the live pointer") {
+    std::byte* moved = GetValueOrFail<std::byte*>(allocator.Resize(first, 512));
+
+    REQUIRE(allocator.Return(moved).has_value());
+    REQUIRE(allocator.Return(moved) == cpp::fail(Error::InvalidInput));
+    REQUIRE(allocator.Return(second).has_value());
+  }
+}
+
+TEST_CASE("FreeList compile-time Find matches the runtime path",
+          "[allocator][FreeList][fixed]") {
+  provider::LockFreePage<> provider;
+  strategy::FreeList<provider::LockFreePage<>> allocator(provider);
+
+  std::byte* block = GetValueOrFail<std::byte*>(allocator.Find<SizeOfT>());
+  std::byte* other = GetValueOrFail<std::byte*>(allocator.Find(SizeOfT));
+
+  REQUIRE(allocator.Return(block).has_value());
+  REQUIRE(allocator.Return(other).has_value());
+}
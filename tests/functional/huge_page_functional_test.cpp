@@ -0,0 +1,33 @@
+#include "catch2/catch_all.hpp"
+
+#include <allocators/provider/huge_page.hpp>
+
+using namespace allocators;
+
+TEST_CASE("HugePage provider hands out huge-page-sized blocks",
+          "[functional][allocator][HugePage]") {
+  provider::HugePage<> allocator;
+
+  SECTION("Block size is the platform huge page size") {
+    REQUIRE(allocator.GetBlockSize() == internal::GetHugePageSize());
+  }
+
+  SECTION("Can allocate, touch, and release a block") {
+    auto p_or = allocator.Provide(1);
+    REQUIRE(p_or.has_value());
+    REQUIRE(p_or.value() != nullptr);
+
+    std::byte* p = p_or.value();
+    for (std::size_t i = 0; i < allocator.GetBlockSize();
+         i += internal::GetPageSize())
+      p[i] = std::byte();
+
+    REQUIRE(allocator.Return(p).has_value());
+  }
+
+  SECTION("While rejecting invalid sizes") {
+    auto p_or = allocator.Provide(0);
+    REQUIRE(p_or.has_error());
+    REQUIRE(p_or.error() == Error::InvalidInput);
+  }
+}
@@ -48,6 +48,27 @@ TEST_CASE("FetchPages", "[internal/platform]") {
   REQUIRE(FetchPages(/*invalid size*/ 0) == cpp::fail(Failure::InvalidSize));
 }
 
+TEST_CASE("FetchAlignedPages", "[internal/platform]") {
+  REQUIRE(FetchAlignedPages(/*invalid size*/ 0, GetPageSize()) ==
+          cpp::fail(Failure::InvalidSize));
+  REQUIRE(FetchAlignedPages(1, /*not a power of two*/ 12345) ==
+          cpp::fail(Failure::InvalidAlignment));
+
+  static constexpr std::size_t kAlignment = 1 << 22;
+  auto va_range_or = FetchAlignedPages(4, kAlignment);
+  REQUIRE(va_range_or.has_value());
+
+  auto va_range = va_range_or.value();
+  REQUIRE((va_range.address & (kAlignment - 1)) == 0);
+
+  // The trimmed mapping is usable end to end.
+  auto* bytes = reinterpret_cast<std::byte*>(va_range.address);
+  bytes[0] = std::byte(0xAA);
+  bytes[va_range.GetSize() - 1] = std::byte(0xBB);
+
+  REQUIRE(ReturnPages(va_range).has_value());
+}
+
 TEST_CASE("ZeroBlock", "[internal/block]") {
   // Basic test that passing in a |nullptr| doesn't crash the process.
   // Of course, there's nothing to assert.
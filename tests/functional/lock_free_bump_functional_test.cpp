@@ -0,0 +1,109 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "catch2/catch_all.hpp"
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/lock_free_bump.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+static constexpr std::size_t kRequestSize = 64;
+
+TEST_CASE("LockFreeBump rewinds to a checkpoint in O(1)",
+          "[functional][allocator][LockFreeBump]") {
+  provider::LockFreePage<> provider;
+  strategy::LockFreeBump<provider::LockFreePage<>,
+                         StatsParams::StatisticsT<true>>
+      allocator(provider);
+
+  SECTION("Rewinding replays the same addresses") {
+    REQUIRE(allocator.Find(kRequestSize).has_value());
+
+    auto marker = allocator.Checkpoint();
+    std::byte* before = GetValueOrFail<std::byte*>(allocator.Find(kRequestSize));
+
+    REQUIRE(allocator.Rewind(marker).has_value());
+
+    std::byte* after = GetValueOrFail<std::byte*>(allocator.Find(kRequestSize));
+    REQUIRE(before == after);
+  }
+
+  SECTION("Rewound blocks are reused without provider round-trips") {
+    auto marker = allocator.Checkpoint();
+
+    // Spill into a second block so the rewind strands one.
+    std::size_t count = provider.GetBlockSize() / kRequestSize + 1;
+    for (std::size_t i = 0; i < count; ++i)
+      REQUIRE(allocator.Find(kRequestSize).has_value());
+
+    std::size_t round_trips =
+        allocator.GetStatistics().provider_round_trips.load();
+
+    REQUIRE(allocator.Rewind(marker).has_value());
+
+    for (std::size_t i = 0; i < count; ++i)
+      REQUIRE(allocator.Find(kRequestSize).has_value());
+
+    REQUIRE(allocator.GetStatistics().provider_round_trips.load() ==
+            round_trips);
+  }
+
+  SECTION("A marker ahead of the current position is rejected") {
+    REQUIRE(allocator.Find(kRequestSize).has_value());
+    auto early = allocator.Checkpoint();
+
+    REQUIRE(allocator.Find(kRequestSize).has_value());
+    auto late = allocator.Checkpoint();
+
+    REQUIRE(allocator.Rewind(early).has_value());
+    REQUIRE(allocator.Rewind(late).has_error());
+  }
+
+  REQUIRE(allocator.Reset().has_value());
+}
+
+TEST_CASE("LockFreeBump serves oversized requests through the provider",
+          "[functional][strategy][LockFreeBump]") {
+  provider::LockFreePage<> provider;
+  strategy::LockFreeBump<provider::LockFreePage<>> allocator(provider);
+
+  std::size_t large_size = 3 * provider.GetBlockSize();
+  std::byte* large =
+      GetValueOrFail<std::byte*>(allocator.Find(large_size));
+  std::memset(large, 0x3C, large_size);
+
+  // Bump allocations still cannot be returned, but the large block can —
+  // it carries its own metadata.
+  std::byte* small = GetValueOrFail<std::byte*>(allocator.Find(kRequestSize));
+  REQUIRE(allocator.Return(small) ==
+          cpp::fail(Error::OperationNotSupported));
+  REQUIRE(allocator.Return(large).has_value());
+  REQUIRE(allocator.Return(large) ==
+          cpp::fail(Error::OperationNotSupported));
+
+  // Reset also reclaims any large blocks still outstanding.
+  REQUIRE(allocator.Find(large_size).has_value());
+  REQUIRE(allocator.Reset().has_value());
+}
+
+TEST_CASE("LockFreeBump compile-time Find matches the runtime path",
+          "[functional][strategy][LockFreeBump]") {
+  provider::LockFreePage<> provider;
+  strategy::LockFreeBump<provider::LockFreePage<>> allocator(provider);
+
+  // Same bump behavior as Find(size): consecutive fixed-size requests are
+  // adjacent.
+  std::byte* first = GetValueOrFail<std::byte*>(allocator.Find<64>());
+  std::byte* second = GetValueOrFail<std::byte*>(allocator.Find<64>());
+  REQUIRE(second == first + 64);
+
+  // Alignment is honored when given explicitly.
+  std::byte* aligned = GetValueOrFail<std::byte*>(allocator.Find<48, 32>());
+  REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 32 == 0);
+
+  REQUIRE(allocator.Reset().has_value());
+}
@@ -44,8 +44,26 @@ TEMPLATE_LIST_TEST_CASE("Page allocator", "[functional][allocator][Page]",
     }
   }
 
-  // TODO: Support multiples pages per request.
-  SECTION("Can allocator multiple pages per request") {}
+  SECTION("Can allocate multiple pages per request") {
+    static constexpr std::size_t kRunLength = 16;
+    AllocatorUnderTest allocator;
+
+    auto p_or = allocator.Provide(kRunLength);
+    REQUIRE(p_or.has_value());
+    REQUIRE(p_or.value() != nullptr);
+
+    std::byte* p = p_or.value();
+    for (std::size_t j = 0; j < kRunLength * kPageSize; ++j)
+      p[j] = std::byte();
+
+    REQUIRE(allocator.Return(p).has_value());
+
+    SECTION("And reuse the pages for single-page requests") {
+      auto single_or = allocator.Provide(1);
+      REQUIRE(single_or.has_value());
+      REQUIRE(allocator.Return(single_or.value()).has_value());
+    }
+  }
 
   SECTION("While rejecting invalid sizes") {
     AllocatorUnderTest allocator;
@@ -56,3 +74,27 @@ TEMPLATE_LIST_TEST_CASE("Page allocator", "[functional][allocator][Page]",
     }
   }
 }
+
+TEST_CASE("UnsynchronizedPage tears down the whole arena in bulk",
+          "[functional][allocator][Page]") {
+  provider::UnsynchronizedPage<> allocator;
+
+  // More outstanding pages than one BlockMap holds, mixing single- and
+  // multi-page runs, so ReleaseAll has to drain a chain of maps and merge
+  // contiguous ranges of both shapes.
+  for (int i = 0; i < 300; ++i)
+    REQUIRE(allocator.Provide(1).has_value());
+
+  REQUIRE(allocator.Provide(16).has_value());
+
+  REQUIRE(allocator.ReleaseAll().has_value());
+
+  // The provider is empty and reusable afterwards.
+  auto page_or = allocator.Provide(1);
+  REQUIRE(page_or.has_value());
+  REQUIRE(allocator.Return(page_or.value()).has_value());
+
+  // A second teardown only has the map page left; a third is a no-op.
+  REQUIRE(allocator.ReleaseAll().has_value());
+  REQUIRE(allocator.ReleaseAll().has_value());
+}
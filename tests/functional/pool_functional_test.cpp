@@ -0,0 +1,74 @@
+#include <cstddef>
+#include <vector>
+
+#include "catch2/catch_all.hpp"
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/pool.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+static constexpr std::size_t kObjectSize = 64;
+
+using AllocatorUnderTest =
+    strategy::Pool<provider::LockFreePage<>,
+                   strategy::PoolParams::ObjectSizeT<kObjectSize>>;
+
+TEST_CASE("Pool serves fixed-size slots in constant time",
+          "[functional][allocator][Pool]") {
+  provider::LockFreePage<> provider;
+  AllocatorUnderTest allocator(provider);
+
+  SECTION("Can allocate and release a single slot") {
+    std::byte* slot = GetValueOrFail<std::byte*>(allocator.Find(kObjectSize));
+    REQUIRE(allocator.Return(slot).has_value());
+  }
+
+  SECTION("Smaller requests still receive a full, distinct slot") {
+    std::byte* first = GetValueOrFail<std::byte*>(allocator.Find(1));
+    std::byte* second = GetValueOrFail<std::byte*>(allocator.Find(kObjectSize));
+
+    REQUIRE(first != second);
+    REQUIRE(static_cast<std::size_t>(second > first ? second - first
+                                                    : first - second) >=
+            AllocatorUnderTest::kSlotSize);
+
+    REQUIRE(allocator.Return(first).has_value());
+    REQUIRE(allocator.Return(second).has_value());
+  }
+
+  SECTION("Released slot is reused by the next request") {
+    std::byte* first = GetValueOrFail<std::byte*>(allocator.Find(kObjectSize));
+    REQUIRE(allocator.Return(first).has_value());
+
+    std::byte* second = GetValueOrFail<std::byte*>(allocator.Find(kObjectSize));
+    REQUIRE(first == second);
+    REQUIRE(allocator.Return(second).has_value());
+  }
+
+  SECTION("Requests larger than the object size are rejected") {
+    REQUIRE(allocator.Find(kObjectSize + 1) ==
+            cpp::fail(Error::SizeRequestTooLarge));
+  }
+
+  SECTION("Pointers that do not land on a slot boundary are rejected") {
+    std::byte* slot = GetValueOrFail<std::byte*>(allocator.Find(kObjectSize));
+    REQUIRE(allocator.Return(slot + 1) == cpp::fail(Error::InvalidInput));
+    REQUIRE(allocator.Return(slot).has_value());
+  }
+
+  SECTION("Pool grows beyond a single provider block") {
+    std::vector<std::byte*> slots;
+    std::size_t count =
+        provider.GetBlockSize() / AllocatorUnderTest::kSlotSize + 1;
+    for (std::size_t i = 0; i < count; ++i)
+      slots.push_back(GetValueOrFail<std::byte*>(allocator.Find(kObjectSize)));
+
+    for (auto* slot : slots)
+      REQUIRE(allocator.Return(slot).has_value());
+  }
+
+  REQUIRE(allocator.Reset().has_value());
+}
@@ -0,0 +1,54 @@
+#include <array>
+#include <cstddef>
+
+#include "catch2/catch_all.hpp"
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/segregated_freelist.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+using T = long;
+static constexpr std::size_t SizeOfT = sizeof(T);
+
+TEST_CASE("SegregatedFreeList serves and reclaims mixed-size requests",
+          "[functional][allocator][SegregatedFreeList]") {
+  provider::LockFreePage<> provider;
+  strategy::SegregatedFreeList<provider::LockFreePage<>> allocator(provider);
+
+  SECTION("Can allocate and release a single object") {
+    T* obj = GetPtrOrFail<T>(allocator.Find(SizeOfT));
+    REQUIRE(allocator.Return(ToBytePtr(obj)).has_value());
+  }
+
+  SECTION("Requests in distinct size classes do not overlap") {
+    std::byte* small = GetValueOrFail<std::byte*>(allocator.Find(32));
+    std::byte* medium = GetValueOrFail<std::byte*>(allocator.Find(256));
+    std::byte* large = GetValueOrFail<std::byte*>(allocator.Find(1024));
+
+    REQUIRE(small != medium);
+    REQUIRE(medium != large);
+
+    REQUIRE(allocator.Return(small).has_value());
+    REQUIRE(allocator.Return(medium).has_value());
+    REQUIRE(allocator.Return(large).has_value());
+  }
+
+  SECTION("Released blocks are reused for same-class requests") {
+    std::byte* first = GetValueOrFail<std::byte*>(allocator.Find(128));
+    REQUIRE(allocator.Return(first).has_value());
+
+    std::byte* second = GetValueOrFail<std::byte*>(allocator.Find(128));
+    REQUIRE(first == second);
+    REQUIRE(allocator.Return(second).has_value());
+  }
+
+  SECTION("Requests beyond the block size are rejected") {
+    REQUIRE(allocator.Find(provider.GetBlockSize() + 1) ==
+            cpp::fail(Error::SizeRequestTooLarge));
+  }
+
+  REQUIRE(allocator.Reset().has_value());
+}
@@ -0,0 +1,64 @@
+#include <cstddef>
+
+#include "catch2/catch_all.hpp"
+
+#include <allocators/provider/static.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+static constexpr std::size_t kBlockSize = 256;
+static constexpr std::size_t kBlockCount = 16;
+
+TEST_CASE("Static provider carves its buffer into blocks",
+          "[functional][provider][Static]") {
+  provider::Static<kBlockSize, kBlockCount> provider;
+
+  SECTION("Single-block configuration still provides exactly one block") {
+    provider::Static<kBlockSize> single;
+    std::byte* block = GetValueOrFail<std::byte*>(single.Provide(1));
+    REQUIRE(single.Provide(1) == cpp::fail(Error::NoFreeBlock));
+    REQUIRE(single.Return(block).has_value());
+    REQUIRE(single.Provide(1).has_value());
+  }
+
+  SECTION("Blocks are handed out as adjacent regions of the buffer") {
+    std::byte* first = GetValueOrFail<std::byte*>(provider.Provide(1));
+    std::byte* second = GetValueOrFail<std::byte*>(provider.Provide(1));
+    REQUIRE(second == first + kBlockSize);
+
+    REQUIRE(provider.Return(first).has_value());
+    REQUIRE(provider.Return(second).has_value());
+  }
+
+  SECTION("Contiguous runs are found, returned, and reused whole") {
+    std::byte* single = GetValueOrFail<std::byte*>(provider.Provide(1));
+    std::byte* run = GetValueOrFail<std::byte*>(provider.Provide(4));
+
+    REQUIRE(provider.Return(run).has_value());
+
+    // The freed run satisfies a smaller request at the same spot.
+    std::byte* reused = GetValueOrFail<std::byte*>(provider.Provide(3));
+    REQUIRE(reused == run);
+
+    REQUIRE(provider.Return(reused).has_value());
+    REQUIRE(provider.Return(single).has_value());
+  }
+
+  SECTION("Exhaustion and invalid requests are rejected") {
+    REQUIRE(provider.Provide(kBlockCount + 1) ==
+            cpp::fail(Error::InvalidInput));
+
+    std::byte* all = GetValueOrFail<std::byte*>(provider.Provide(kBlockCount));
+    REQUIRE(provider.Provide(1) == cpp::fail(Error::NoFreeBlock));
+    REQUIRE(provider.Return(all).has_value());
+  }
+
+  SECTION("Double frees and interior pointers are rejected") {
+    std::byte* block = GetValueOrFail<std::byte*>(provider.Provide(1));
+    REQUIRE(provider.Return(block + 1) == cpp::fail(Error::InvalidInput));
+    REQUIRE(provider.Return(block).has_value());
+    REQUIRE(provider.Return(block) == cpp::fail(Error::InvalidInput));
+  }
+}
@@ -0,0 +1,39 @@
+#include "catch2/catch_all.hpp"
+
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/freelist.hpp>
+#include <allocators/strategy/lock_free_bump.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+TEST_CASE("Statistics are collected when enabled",
+          "[functional][stats][LockFreeBump]") {
+  provider::LockFreePage<> provider;
+  strategy::LockFreeBump<provider::LockFreePage<>,
+                         StatsParams::StatisticsT<true>>
+      allocator(provider);
+
+  static constexpr std::size_t kCount = 8;
+  static constexpr std::size_t kSize = 64;
+
+  for (std::size_t i = 0; i < kCount; ++i)
+    REQUIRE(allocator.Find(kSize).has_value());
+
+  const Statistics& stats = allocator.GetStatistics();
+  REQUIRE(stats.allocation_count.load() == kCount);
+  REQUIRE(stats.bytes_outstanding.load() == kCount * kSize);
+  REQUIRE(stats.provider_round_trips.load() >= 1);
+
+  REQUIRE(allocator.Reset().has_value());
+}
+
+TEST_CASE("Disabled statistics cost no space",
+          "[functional][stats][LockFreeBump]") {
+  using WithStats = strategy::LockFreeBump<provider::LockFreePage<>,
+                                           StatsParams::StatisticsT<true>>;
+  using WithoutStats = strategy::LockFreeBump<provider::LockFreePage<>>;
+
+  REQUIRE(sizeof(WithoutStats) < sizeof(WithStats));
+}
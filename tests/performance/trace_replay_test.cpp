@@ -0,0 +1,211 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "catch2/catch_all.hpp"
+
+#include <allocators/common/trace.hpp>
+#include <allocators/provider/lock_free_page.hpp>
+#include <allocators/strategy/freelist.hpp>
+#include <allocators/strategy/segregated_freelist.hpp>
+#include <allocators/strategy/traced.hpp>
+
+#include "../util.hpp"
+
+using namespace allocators;
+
+namespace {
+
+// Resident set size straight from the kernel; the interesting number for a
+// fragmentation report is what the heap actually holds, not what was
+// requested.
+std::size_t GetResidentBytes() {
+#if defined(__linux__)
+  long size = 0;
+  long resident = 0;
+  std::FILE* file = std::fopen("/proc/self/statm", "r");
+  if (file == nullptr)
+    return 0;
+
+  if (std::fscanf(file, "%ld %ld", &size, &resident) != 2)
+    resident = 0;
+
+  std::fclose(file);
+  return static_cast<std::size_t>(resident) * internal::GetPageSize();
+#else
+  return 0;
+#endif
+}
+
+struct ReplayReport {
+  std::size_t replayed = 0;
+  std::size_t skipped = 0;
+  std::size_t failed = 0;
+  std::size_t peak_live_bytes = 0;
+  std::size_t rss_delta_bytes = 0;
+  double events_per_second = 0.0;
+};
+
+// Re-executes a captured trace against |strategy|. Recorded addresses are
+// identities, not pointers: each Find event maps its recorded address to
+// the pointer this run produced, and each Return event frees through that
+// map. Returns of addresses never seen (allocated before capture began)
+// are skipped, not failed.
+template <class Strategy>
+ReplayReport Replay(Strategy& strategy,
+                    const std::vector<TraceEvent>& events) {
+  ReplayReport report;
+  std::unordered_map<std::uint64_t, std::byte*> live;
+  std::unordered_map<std::uint64_t, std::size_t> live_size;
+  std::size_t live_bytes = 0;
+
+  std::size_t rss_before = GetResidentBytes();
+  auto start = std::chrono::steady_clock::now();
+
+  for (const TraceEvent& event : events) {
+    switch (event.kind) {
+    case TraceEvent::Kind::Find: {
+      auto result = strategy.Find(Layout(event.size, event.alignment));
+      if (result.has_error()) {
+        ++report.failed;
+        break;
+      }
+
+      live[event.address] = result.value();
+      live_size[event.address] = event.size;
+      live_bytes += event.size;
+      report.peak_live_bytes = std::max(report.peak_live_bytes, live_bytes);
+      ++report.replayed;
+      break;
+    }
+    case TraceEvent::Kind::Return: {
+      auto it = live.find(event.address);
+      if (it == live.end()) {
+        ++report.skipped;
+        break;
+      }
+
+      if (strategy.Return(it->second).has_error())
+        ++report.failed;
+      else
+        ++report.replayed;
+
+      live_bytes -= live_size[event.address];
+      live_size.erase(event.address);
+      live.erase(it);
+      break;
+    }
+    case TraceEvent::Kind::Reset:
+      if (strategy.Reset().has_error())
+        ++report.failed;
+      else
+        ++report.replayed;
+
+      live.clear();
+      live_size.clear();
+      live_bytes = 0;
+      break;
+    }
+  }
+
+  auto elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start);
+  std::size_t rss_after = GetResidentBytes();
+
+  report.rss_delta_bytes = rss_after > rss_before ? rss_after - rss_before : 0;
+  report.events_per_second =
+      elapsed.count() > 0.0 ? events.size() / elapsed.count() : 0.0;
+  return report;
+}
+
+// Stand-in for a captured production workload: size-mixed churn with a
+// long-lived survivor per round, the shape that provokes fragmentation.
+TraceLog RecordSyntheticWorkload() {
+  static constexpr std::size_t kRounds = 2000;
+  static constexpr std::array kSizes = {24ul, 56ul, 120ul, 248ul, 504ul};
+
+  TraceLog log;
+  provider::LockFreePage<> provider;
+  strategy::FreeList<provider::LockFreePage<>> freelist(provider);
+  strategy::Traced traced(freelist, log);
+
+  std::vector<std::byte*> survivors;
+  for (std::size_t round = 0; round < kRounds; ++round) {
+    std::array<std::byte*, kSizes.size()> batch = {nullptr};
+    for (std::size_t i = 0; i < kSizes.size(); ++i)
+      batch[i] = GetValueOrFail<std::byte*>(traced.Find(kSizes[i]));
+
+    // Keep one object per round alive; free the rest immediately.
+    survivors.push_back(batch[round % kSizes.size()]);
+    for (std::size_t i = 0; i < kSizes.size(); ++i)
+      if (batch[i] != survivors.back())
+        REQUIRE(traced.Return(batch[i]).has_value());
+
+    if (round % 500 == 499) {
+      for (std::byte* survivor : survivors)
+        REQUIRE(traced.Return(survivor).has_value());
+
+      survivors.clear();
+    }
+  }
+
+  for (std::byte* survivor : survivors)
+    REQUIRE(traced.Return(survivor).has_value());
+
+  REQUIRE(traced.Reset().has_value());
+  REQUIRE(log.GetDroppedCount() == 0);
+  return log;
+}
+
+} // namespace
+
+TEST_CASE("Captured traces replay against any strategy",
+          "[performance][trace]") {
+  // Record, round-trip through the on-disk format, then replay — the same
+  // path a trace from a production incident takes.
+  TraceLog recorded = RecordSyntheticWorkload();
+  REQUIRE(!recorded.GetEvents().empty());
+
+  std::string path =
+      (std::filesystem::temp_directory_path() / "allocators_trace.bin")
+          .string();
+  REQUIRE(recorded.Save(path.c_str()).has_value());
+
+  auto loaded_or = TraceLog::Load(path.c_str());
+  REQUIRE(loaded_or.has_value());
+  const TraceLog& loaded = loaded_or.value();
+  REQUIRE(loaded.GetEvents().size() == recorded.GetEvents().size());
+
+  SECTION("FreeList") {
+    provider::LockFreePage<> provider;
+    strategy::FreeList<provider::LockFreePage<>> strategy(provider);
+
+    ReplayReport report = Replay(strategy, loaded.GetEvents());
+    REQUIRE(report.failed == 0);
+
+    WARN("FreeList replay: " << report.replayed << " events, "
+                             << report.events_per_second << " events/s, peak "
+                             << report.peak_live_bytes << "B live, RSS +"
+                             << report.rss_delta_bytes << "B");
+  }
+
+  SECTION("SegregatedFreeList") {
+    provider::LockFreePage<> provider;
+    strategy::SegregatedFreeList<provider::LockFreePage<>> strategy(provider);
+
+    ReplayReport report = Replay(strategy, loaded.GetEvents());
+    REQUIRE(report.failed == 0);
+
+    WARN("SegregatedFreeList replay: "
+         << report.replayed << " events, " << report.events_per_second
+         << " events/s, peak " << report.peak_live_bytes << "B live, RSS +"
+         << report.rss_delta_bytes << "B");
+  }
+
+  std::filesystem::remove(path);
+}